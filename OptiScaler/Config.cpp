@@ -61,6 +61,8 @@ bool Config::Reload(std::filesystem::path iniPath)
             Dx11Upscaler.set_from_config(readString("Upscalers", "Dx11Upscaler", true));
             Dx12Upscaler.set_from_config(readString("Upscalers", "Dx12Upscaler", true));
             VulkanUpscaler.set_from_config(readString("Upscalers", "VulkanUpscaler", true));
+            UpscalerPrewarm.set_from_config(readBool("Upscalers", "Prewarm"));
+            UpscalerPoolKeepTime.set_from_config(readInt("Upscalers", "PoolKeepTime"));
         }
 
         // Frame Generation
@@ -144,6 +146,7 @@ bool Config::Reload(std::filesystem::path iniPath)
             FGFPTAllowHybridSpin.set_from_config(readBool("FSRFG", "FPTHybridSpin"));
             FGFPTHybridSpinTime.set_from_config(readInt("FSRFG", "FPTHybridSpinTime"));
             FGFPTAllowWaitForSingleObjectOnFence.set_from_config(readInt("FSRFG", "FPTWaitForSingleObjectOnFence"));
+            FGFPTAutoTune.set_from_config(readBool("FSRFG", "FPTAutoTune"));
             FSRFGEnableWatermark.set_from_config(readBool("FSRFG", "EnableWatermark"));
         }
 
@@ -158,6 +161,7 @@ bool Config::Reload(std::filesystem::path iniPath)
             FGResourceBlocking.set_from_config(readBool("OptiFG", "ResourceBlocking"));
             FGMakeDepthCopy.set_from_config(readBool("OptiFG", "MakeDepthCopy"));
             FGMakeMVCopy.set_from_config(readBool("OptiFG", "MakeMVCopy"));
+            FGCopyElision.set_from_config(readBool("OptiFG", "CopyElision"));
             FGHudfixDisableRTV.set_from_config(readBool("OptiFG", "HudfixDisableRTV"));
             FGHudfixDisableSRV.set_from_config(readBool("OptiFG", "HudfixDisableSRV"));
             FGHudfixDisableUAV.set_from_config(readBool("OptiFG", "HudfixDisableUAV"));
@@ -176,6 +180,7 @@ bool Config::Reload(std::filesystem::path iniPath)
 
             FGResourceFlip.set_from_config(readBool("OptiFG", "ResourceFlip"));
             FGResourceFlipOffset.set_from_config(readBool("OptiFG", "ResourceFlipOffset"));
+            FGAsyncPrep.set_from_config(readBool("OptiFG", "AsyncPrep"));
 
             FGAlwaysCaptureFSRFGSwapchain.set_from_config(readBool("OptiFG", "AlwaysCaptureFSRFGSwapchain"));
         }
@@ -486,6 +491,10 @@ bool Config::Reload(std::filesystem::path iniPath)
         {
             DrsMinOverrideEnabled.set_from_config(readBool("DRS", "DrsMinOverrideEnabled"));
             DrsMaxOverrideEnabled.set_from_config(readBool("DRS", "DrsMaxOverrideEnabled"));
+            DrsGovernorEnabled.set_from_config(readBool("DRS", "GovernorEnabled"));
+            DrsGovernorTargetFps.set_from_config(readFloat("DRS", "GovernorTargetFps"));
+            DrsGovernorMinRatio.set_from_config(readFloat("DRS", "GovernorMinRatio"));
+            DrsGovernorMaxRatio.set_from_config(readFloat("DRS", "GovernorMaxRatio"));
         }
 
         // Upscale Ratio Override
@@ -610,6 +619,8 @@ bool Config::Reload(std::filesystem::path iniPath)
             else
                 FN_LatencyFlexMode.reset();
 
+            FN_LatencyFlexGpuFeedback.set_from_config(readBool("fakenvapi", "LatencyFlexGpuFeedback"));
+
             if (auto v = readEnum<ForceReflex>("fakenvapi", "ForceReflex"))
                 FN_ForceReflex.set_from_config(*v);
             else
@@ -747,6 +758,9 @@ bool Config::SaveIni()
         ini.SetValue("Upscalers", "Dx11Upscaler", Instance()->Dx11Upscaler.value_for_config_or("auto").c_str());
         ini.SetValue("Upscalers", "Dx12Upscaler", Instance()->Dx12Upscaler.value_for_config_or("auto").c_str());
         ini.SetValue("Upscalers", "VulkanUpscaler", Instance()->VulkanUpscaler.value_for_config_or("auto").c_str());
+        ini.SetValue("Upscalers", "Prewarm", GetBoolValue(Instance()->UpscalerPrewarm.value_for_config()).c_str());
+        ini.SetValue("Upscalers", "PoolKeepTime",
+                     GetIntValue(Instance()->UpscalerPoolKeepTime.value_for_config()).c_str());
     }
 
     // Frame Generation
@@ -841,6 +855,7 @@ bool Config::SaveIni()
                      GetIntValue(Instance()->FGFPTHybridSpinTime.value_for_config()).c_str());
         ini.SetValue("FSRFG", "FPTWaitForSingleObjectOnFence",
                      GetBoolValue(Instance()->FGFPTAllowWaitForSingleObjectOnFence.value_for_config()).c_str());
+        ini.SetValue("FSRFG", "FPTAutoTune", GetBoolValue(Instance()->FGFPTAutoTune.value_for_config()).c_str());
         ini.SetValue("FSRFG", "EnableWatermark",
                      GetBoolValue(Instance()->FSRFGEnableWatermark.value_for_config()).c_str());
     }
@@ -874,6 +889,7 @@ bool Config::SaveIni()
                      GetBoolValue(Instance()->FGResourceBlocking.value_for_config()).c_str());
         ini.SetValue("OptiFG", "MakeDepthCopy", GetBoolValue(Instance()->FGMakeDepthCopy.value_for_config()).c_str());
         ini.SetValue("OptiFG", "MakeMVCopy", GetBoolValue(Instance()->FGMakeMVCopy.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "CopyElision", GetBoolValue(Instance()->FGCopyElision.value_for_config()).c_str());
 
         ini.SetValue("OptiFG", "HudfixDisableRTV",
                      GetBoolValue(Instance()->FGHudfixDisableRTV.value_for_config()).c_str());
@@ -905,6 +921,7 @@ bool Config::SaveIni()
         ini.SetValue("OptiFG", "ResourceFlip", GetBoolValue(Instance()->FGResourceFlip.value_for_config()).c_str());
         ini.SetValue("OptiFG", "ResourceFlipOffset",
                      GetBoolValue(Instance()->FGResourceFlipOffset.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "AsyncPrep", GetBoolValue(Instance()->FGAsyncPrep.value_for_config()).c_str());
 
         ini.SetValue("OptiFG", "AlwaysCaptureFSRFGSwapchain",
                      GetBoolValue(Instance()->FGAlwaysCaptureFSRFGSwapchain.value_for_config()).c_str());
@@ -1246,6 +1263,13 @@ bool Config::SaveIni()
                      GetBoolValue(Instance()->DrsMinOverrideEnabled.value_for_config()).c_str());
         ini.SetValue("DRS", "DrsMaxOverrideEnabled",
                      GetBoolValue(Instance()->DrsMaxOverrideEnabled.value_for_config()).c_str());
+        ini.SetValue("DRS", "GovernorEnabled", GetBoolValue(Instance()->DrsGovernorEnabled.value_for_config()).c_str());
+        ini.SetValue("DRS", "GovernorTargetFps",
+                     GetFloatValue(Instance()->DrsGovernorTargetFps.value_for_config()).c_str());
+        ini.SetValue("DRS", "GovernorMinRatio",
+                     GetFloatValue(Instance()->DrsGovernorMinRatio.value_for_config()).c_str());
+        ini.SetValue("DRS", "GovernorMaxRatio",
+                     GetFloatValue(Instance()->DrsGovernorMaxRatio.value_for_config()).c_str());
     }
 
     // Spoofing
@@ -1307,6 +1331,8 @@ bool Config::SaveIni()
                      GetBoolValue(Instance()->FN_ForceLatencyFlex.value_for_config()).c_str());
         ini.SetValue("fakenvapi", "LatencyFlexMode",
                      GetIntValue(Instance()->FN_LatencyFlexMode.value_for_config()).c_str());
+        ini.SetValue("fakenvapi", "LatencyFlexGpuFeedback",
+                     GetBoolValue(Instance()->FN_LatencyFlexGpuFeedback.value_for_config()).c_str());
         ini.SetValue("fakenvapi", "ForceReflex", GetIntValue(Instance()->FN_ForceReflex.value_for_config()).c_str());
     }
 
@@ -298,6 +298,10 @@ class Config
     // DRS
     CustomOptional<bool> DrsMinOverrideEnabled { false };
     CustomOptional<bool> DrsMaxOverrideEnabled { false };
+    CustomOptional<bool> DrsGovernorEnabled { false };
+    CustomOptional<float> DrsGovernorTargetFps { 60.0f };
+    CustomOptional<float> DrsGovernorMinRatio { 1.0f };
+    CustomOptional<float> DrsGovernorMaxRatio { 2.0f };
 
     // Quality Overrides
     CustomOptional<bool> QualityRatioOverrideEnabled { false };
@@ -358,6 +362,8 @@ class Config
     CustomOptional<std::string, SoftDefault> Dx11Upscaler { std::string(OptiKeys::FSR22) };
     CustomOptional<std::string, SoftDefault> Dx12Upscaler { std::string(OptiKeys::XeSS) };
     CustomOptional<std::string, SoftDefault> VulkanUpscaler { std::string(OptiKeys::FSR22) };
+    CustomOptional<bool> UpscalerPrewarm { false };
+    CustomOptional<int> UpscalerPoolKeepTime { 5000 };
 
     // Output Scaling
     CustomOptional<bool> OutputScalingEnabled { false };
@@ -400,6 +406,7 @@ class Config
     // vulkanwdx12
     CustomOptional<bool> VulkanUseCopyForInputs { false };
     CustomOptional<bool> VulkanUseCopyForOutput { false };
+    CustomOptional<bool> VulkanAliasInputs { false };
 
     // NVAPI Override
     CustomOptional<bool> DisableFlipMetering { false };
@@ -455,8 +462,10 @@ class Config
     CustomOptional<bool> FGUseMutexForSwapchain { true };
     CustomOptional<bool> FGMakeMVCopy { true };
     CustomOptional<bool> FGMakeDepthCopy { true };
+    CustomOptional<bool> FGCopyElision { false };
     CustomOptional<bool> FGResourceFlip { false };
     CustomOptional<bool> FGResourceFlipOffset { false };
+    CustomOptional<bool> FGAsyncPrep { false };
     CustomOptional<bool> FGAlwaysCaptureFSRFGSwapchain { false };
 
     CustomOptional<int, NoDefault> FGRectLeft;
@@ -502,6 +511,7 @@ class Config
     CustomOptional<bool> FGFPTAllowHybridSpin { false };
     CustomOptional<int> FGFPTHybridSpinTime { 2 };
     CustomOptional<bool> FGFPTAllowWaitForSingleObjectOnFence { false };
+    CustomOptional<bool> FGFPTAutoTune { false };
 
     CustomOptional<bool> FSRFGSkipConfigForHudless { false };
     CustomOptional<bool> FSRFGSkipDispatchForHudless { false };
@@ -522,6 +532,7 @@ class Config
     CustomOptional<bool> XeFGWithoutXeLL { false };
     CustomOptional<bool> FN_ForceLatencyFlex { false };
     CustomOptional<LFXMode> FN_LatencyFlexMode { LFXMode::Conservative };
+    CustomOptional<bool> FN_LatencyFlexGpuFeedback { false };
     CustomOptional<ForceReflex> FN_ForceReflex { ForceReflex::InGame };
 
     // Inputs
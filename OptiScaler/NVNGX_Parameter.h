@@ -3,6 +3,7 @@
 #include "Config.h"
 #include <ankerl/unordered_dense.h>
 #include <misc/IdentifyGpu.h>
+#include <upscalers/RenderScaleGovernor.h>
 
 // Use real NVNGX params encapsulated in custom one
 // Which is not working correctly
@@ -102,92 +103,100 @@ inline static std::optional<float> GetQualityOverrideRatio(const NVSDK_NGX_PerfQ
     return output;
 }
 
-/// @brief Callback invoked by the game/SDK to calculate optimal DLSS render settings (resolution, scaling) based on
-/// inputs.
-/// @param InParams The parameter object containing input width/height and output destinations.
-/// @return Success or Failure result code.
-inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSS_GetOptimalSettingsCallback(NVSDK_NGX_Parameter* InParams)
+/// @brief Render size of a quality mode, same as the optimal settings query returns for it.
+inline static void GetOptimalRenderSize(NVSDK_NGX_PerfQuality_Value enumPQValue, unsigned int Width,
+                                        unsigned int Height, unsigned int* OutWidth, unsigned int* OutHeight,
+                                        float* scalingRatio)
 {
-    unsigned int Width;
-    unsigned int Height;
-    unsigned int OutWidth;
-    unsigned int OutHeight;
-    float scalingRatio = 0.0f;
-    int PerfQualityValue;
-
-    if (InParams->Get(NVSDK_NGX_Parameter_Width, &Width) != NVSDK_NGX_Result_Success ||
-        InParams->Get(NVSDK_NGX_Parameter_Height, &Height) != NVSDK_NGX_Result_Success ||
-        InParams->Get(NVSDK_NGX_Parameter_PerfQualityValue, &PerfQualityValue) != NVSDK_NGX_Result_Success)
-        return NVSDK_NGX_Result_Fail;
-
-    auto enumPQValue = (NVSDK_NGX_PerfQuality_Value) PerfQualityValue;
-
-    LOG_DEBUG("Display Resolution: {0}x{1}", Width, Height);
-
     const std::optional<float> QualityRatio = GetQualityOverrideRatio(enumPQValue);
 
     if (QualityRatio.has_value())
     {
-        OutHeight = (unsigned int) ((float) Height / QualityRatio.value());
-        OutWidth = (unsigned int) ((float) Width / QualityRatio.value());
-        scalingRatio = 1.0f / QualityRatio.value();
+        *OutHeight = (unsigned int) ((float) Height / QualityRatio.value());
+        *OutWidth = (unsigned int) ((float) Width / QualityRatio.value());
+        *scalingRatio = 1.0f / QualityRatio.value();
     }
     else
     {
-        LOG_DEBUG("Quality: {0}", PerfQualityValue);
+        LOG_DEBUG("Quality: {0}", (int) enumPQValue);
 
         switch (enumPQValue)
         {
         case NVSDK_NGX_PerfQuality_Value_UltraPerformance:
-            OutHeight = (unsigned int) ((float) Height / 3.0);
-            OutWidth = (unsigned int) ((float) Width / 3.0);
-            scalingRatio = 0.33333333f;
+            *OutHeight = (unsigned int) ((float) Height / 3.0);
+            *OutWidth = (unsigned int) ((float) Width / 3.0);
+            *scalingRatio = 0.33333333f;
             break;
 
         case NVSDK_NGX_PerfQuality_Value_MaxPerf:
-            OutHeight = (unsigned int) ((float) Height / 2.0);
-            OutWidth = (unsigned int) ((float) Width / 2.0);
-            scalingRatio = 0.5f;
+            *OutHeight = (unsigned int) ((float) Height / 2.0);
+            *OutWidth = (unsigned int) ((float) Width / 2.0);
+            *scalingRatio = 0.5f;
             break;
 
         case NVSDK_NGX_PerfQuality_Value_Balanced:
-            OutHeight = (unsigned int) ((float) Height / 1.7);
-            OutWidth = (unsigned int) ((float) Width / 1.7);
-            scalingRatio = 1.0f / 1.7f;
+            *OutHeight = (unsigned int) ((float) Height / 1.7);
+            *OutWidth = (unsigned int) ((float) Width / 1.7);
+            *scalingRatio = 1.0f / 1.7f;
             break;
 
         case NVSDK_NGX_PerfQuality_Value_MaxQuality:
-            OutHeight = (unsigned int) ((float) Height / 1.5);
-            OutWidth = (unsigned int) ((float) Width / 1.5);
-            scalingRatio = 1.0f / 1.5f;
+            *OutHeight = (unsigned int) ((float) Height / 1.5);
+            *OutWidth = (unsigned int) ((float) Width / 1.5);
+            *scalingRatio = 1.0f / 1.5f;
             break;
 
         case NVSDK_NGX_PerfQuality_Value_UltraQuality:
-            OutHeight = (unsigned int) ((float) Height / 1.3);
-            OutWidth = (unsigned int) ((float) Width / 1.3);
-            scalingRatio = 1.0f / 1.3f;
+            *OutHeight = (unsigned int) ((float) Height / 1.3);
+            *OutWidth = (unsigned int) ((float) Width / 1.3);
+            *scalingRatio = 1.0f / 1.3f;
             break;
 
         case NVSDK_NGX_PerfQuality_Value_DLAA:
-            OutHeight = Height;
-            OutWidth = Width;
-            scalingRatio = 1.0f;
+            *OutHeight = Height;
+            *OutWidth = Width;
+            *scalingRatio = 1.0f;
             break;
 
         default:
-            OutHeight = (unsigned int) ((float) Height / 1.7);
-            OutWidth = (unsigned int) ((float) Width / 1.7);
-            scalingRatio = 1.0f / 1.7f;
+            *OutHeight = (unsigned int) ((float) Height / 1.7);
+            *OutWidth = (unsigned int) ((float) Width / 1.7);
+            *scalingRatio = 1.0f / 1.7f;
             break;
         }
     }
 
     if (Config::Instance()->RoundInternalResolution.has_value())
     {
-        OutHeight -= OutHeight % Config::Instance()->RoundInternalResolution.value();
-        OutWidth -= OutWidth % Config::Instance()->RoundInternalResolution.value();
-        scalingRatio = (float) OutWidth / (float) Width;
+        *OutHeight -= *OutHeight % Config::Instance()->RoundInternalResolution.value();
+        *OutWidth -= *OutWidth % Config::Instance()->RoundInternalResolution.value();
+        *scalingRatio = (float) *OutWidth / (float) Width;
     }
+}
+
+/// @brief Callback invoked by the game/SDK to calculate optimal DLSS render settings (resolution, scaling) based on
+/// inputs.
+/// @param InParams The parameter object containing input width/height and output destinations.
+/// @return Success or Failure result code.
+inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSS_GetOptimalSettingsCallback(NVSDK_NGX_Parameter* InParams)
+{
+    unsigned int Width;
+    unsigned int Height;
+    unsigned int OutWidth;
+    unsigned int OutHeight;
+    float scalingRatio = 0.0f;
+    int PerfQualityValue;
+
+    if (InParams->Get(NVSDK_NGX_Parameter_Width, &Width) != NVSDK_NGX_Result_Success ||
+        InParams->Get(NVSDK_NGX_Parameter_Height, &Height) != NVSDK_NGX_Result_Success ||
+        InParams->Get(NVSDK_NGX_Parameter_PerfQualityValue, &PerfQualityValue) != NVSDK_NGX_Result_Success)
+        return NVSDK_NGX_Result_Fail;
+
+    auto enumPQValue = (NVSDK_NGX_PerfQuality_Value) PerfQualityValue;
+
+    LOG_DEBUG("Display Resolution: {0}x{1}", Width, Height);
+
+    GetOptimalRenderSize(enumPQValue, Width, Height, &OutWidth, &OutHeight, &scalingRatio);
 
     InParams->Set(NVSDK_NGX_Parameter_Scale, scalingRatio);
     InParams->Set(NVSDK_NGX_Parameter_SuperSampling_ScaleFactor, scalingRatio);
@@ -247,6 +256,22 @@ inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSS_GetOptimalSettingsCallb
         }
     }
 
+    // Governor caps the game's DRS at the governed size, the game keeps picking the size below it
+    if (RenderScaleGovernor::Active())
+    {
+        unsigned int minWidth = 0;
+        unsigned int minHeight = 0;
+        unsigned int maxWidth = 0;
+        unsigned int maxHeight = 0;
+
+        RenderScaleGovernor::Range(Width, Height, minWidth, minHeight, maxWidth, maxHeight);
+
+        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, minWidth);
+        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, minHeight);
+        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, maxWidth);
+        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, maxHeight);
+    }
+
     InParams->Set(NVSDK_NGX_Parameter_SizeInBytes, Width * Height * 31);
     InParams->Set(NVSDK_NGX_Parameter_DLSSMode, NVSDK_NGX_DLSS_Mode_DLSS_DLISP);
 
@@ -393,6 +418,22 @@ inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSSD_GetOptimalSettingsCall
         InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, Height);
     }
 
+    // Governor caps the game's DRS at the governed size, the game keeps picking the size below it
+    if (RenderScaleGovernor::Active())
+    {
+        unsigned int minWidth = 0;
+        unsigned int minHeight = 0;
+        unsigned int maxWidth = 0;
+        unsigned int maxHeight = 0;
+
+        RenderScaleGovernor::Range(Width, Height, minWidth, minHeight, maxWidth, maxHeight);
+
+        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, minWidth);
+        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, minHeight);
+        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, maxWidth);
+        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, maxHeight);
+    }
+
     InParams->Set(NVSDK_NGX_Parameter_SizeInBytes, Width * Height * 31);
     InParams->Set(NVSDK_NGX_Parameter_DLSSMode, NVSDK_NGX_DLSS_Mode_DLSS_DLISP);
 
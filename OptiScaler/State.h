@@ -6,6 +6,7 @@
 
 #include <set>
 #include <deque>
+#include <atomic>
 #include <vulkan/vulkan.h>
 #include <ankerl/unordered_dense.h>
 #include <mutex>
@@ -115,7 +116,8 @@ class State
     bool FGHudlessCompare = false;
     bool FGchanged = false;
     bool SCchanged = false;
-    bool skipHeapCapture = false;
+    // Per thread, backend features are also created on worker threads while the game creates its heaps
+    inline static thread_local bool skipHeapCapture = false;
 
     bool FGcaptureResources = false;
     size_t FGcapturedResourceCount = false;
@@ -232,6 +234,7 @@ class State
     std::string latestVersionTag;
     std::string latestVersionUrl;
     std::string versionCheckError;
+    std::atomic<uint32_t> versionCheckGeneration = 0; // Increased when new results are published
 
     // Swapchain info
     float screenWidth = 800.0;
@@ -4,6 +4,7 @@
 #include "Config.h"
 
 #include <shlobj.h>
+#include <tlhelp32.h>
 
 typedef LONG(WINAPI* RtlGetVersionPtr)(PRTL_OSVERSIONINFOW);
 typedef decltype(&GetFileVersionInfoSizeW) PFN_GetFileVersionInfoSizeW;
@@ -12,6 +13,90 @@ typedef decltype(&VerQueryValueW) PFN_VerQueryValueW;
 
 static IID streamlineRiid {};
 
+// Replaced when a caller is in a module it doesn't know or a module gets unloaded.
+// Built without holding any lock, Toolhelp takes the loader lock which callers might already hold.
+static std::atomic<std::shared_ptr<const ModuleRangeTable>> moduleTable;
+static std::atomic<bool> moduleTableStale = true;
+
+static ModuleRangeTable BuildModuleTable()
+{
+    std::vector<ModuleRange> ranges;
+
+    auto snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE, 0);
+    if (snapshot == INVALID_HANDLE_VALUE)
+        return ModuleRangeTable();
+
+    auto exeModule = GetModuleHandleW(nullptr);
+
+    MODULEENTRY32W entry {};
+    entry.dwSize = sizeof(entry);
+
+    for (auto found = Module32FirstW(snapshot, &entry); found; found = Module32NextW(snapshot, &entry))
+    {
+        ModuleRange range {};
+        range.base = (uintptr_t) entry.modBaseAddr;
+        range.end = range.base + entry.modBaseSize;
+        range.handle = entry.hModule;
+
+        range.name = wstring_to_string(entry.szModule);
+
+        if (entry.hModule == exeModule)
+            range.id = KnownModule::GameExe;
+        else if (entry.hModule == dllModule)
+            range.id = KnownModule::OptiScaler;
+        else
+            range.id = ClassifyModuleName(range.name);
+
+        ranges.push_back(std::move(range));
+    }
+
+    CloseHandle(snapshot);
+
+    return ModuleRangeTable(std::move(ranges));
+}
+
+static std::shared_ptr<const ModuleRangeTable> GetModuleTable()
+{
+    auto table = moduleTable.load(std::memory_order_acquire);
+
+    if (table != nullptr && !moduleTableStale.load(std::memory_order_acquire)) [[likely]]
+        return table;
+
+    // Cleared before building so an invalidation that happens during the build isn't lost.
+    // Threads racing here build their own copy, the last one stays.
+    moduleTableStale.store(false, std::memory_order_release);
+
+    table = std::make_shared<const ModuleRangeTable>(BuildModuleTable());
+    moduleTable.store(table, std::memory_order_release);
+
+    return table;
+}
+
+// Returned range stays valid as long as the caller keeps the table
+static const ModuleRange* FindCallerRange(void* returnAddress, std::shared_ptr<const ModuleRangeTable>& table)
+{
+    auto address = (uintptr_t) returnAddress;
+
+    table = GetModuleTable();
+
+    if (auto range = table->Find(address); range != nullptr)
+        return range;
+
+    // Module might be loaded after the last rebuild, only rebuild if the address belongs to one
+    HMODULE hModule = NULL;
+    if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                            (LPCSTR) returnAddress, &hModule) ||
+        hModule == NULL)
+    {
+        return nullptr;
+    }
+
+    moduleTableStale.store(true, std::memory_order_release);
+    table = GetModuleTable();
+
+    return table->Find(address);
+}
+
 /// <summary>
 /// Returns caller module filename
 /// Don't forget to add #pragma intrinsic(_ReturnAddress)
@@ -20,6 +105,11 @@ static IID streamlineRiid {};
 /// <returns>Caller module filename</returns>
 std::string Util::WhoIsTheCaller(void* returnAddress)
 {
+    std::shared_ptr<const ModuleRangeTable> table;
+
+    if (auto range = FindCallerRange(returnAddress, table); range != nullptr)
+        return range->name;
+
     char callerPath[MAX_PATH] = { 0 };
 
     // Get the return address from the current function call.
@@ -40,6 +130,11 @@ std::string Util::WhoIsTheCaller(void* returnAddress)
 
 HMODULE Util::GetCallerModule(void* returnAddress)
 {
+    std::shared_ptr<const ModuleRangeTable> table;
+
+    if (auto range = FindCallerRange(returnAddress, table); range != nullptr)
+        return (HMODULE) range->handle;
+
     HMODULE hModule = NULL;
 
     GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
@@ -48,6 +143,31 @@ HMODULE Util::GetCallerModule(void* returnAddress)
     return hModule;
 }
 
+KnownModule Util::GetCallerModuleId(void* returnAddress)
+{
+    std::shared_ptr<const ModuleRangeTable> table;
+
+    if (auto range = FindCallerRange(returnAddress, table); range != nullptr)
+        return range->id;
+
+    return KnownModule::Unknown;
+}
+
+// Called after a FreeLibrary, table is only rebuilt if the module is really gone
+void Util::ModuleFreed(void* module)
+{
+    HMODULE hModule = NULL;
+
+    if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                           (LPCSTR) module, &hModule) &&
+        hModule == module)
+    {
+        return;
+    }
+
+    moduleTableStale.store(true, std::memory_order_release);
+}
+
 std::wstring Util::GetWindowTitle(HWND hwnd)
 {
     const int maxLength = 512;
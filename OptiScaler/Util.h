@@ -3,6 +3,8 @@
 
 #include <filesystem>
 
+#include <misc/ModuleRanges.h>
+
 #include <dxgi.h>
 #include <xess.h>
 
@@ -44,6 +46,8 @@ std::optional<std::filesystem::path> FindFilePath(const std::filesystem::path& s
                                                   const std::filesystem::path fileName);
 std::string WhoIsTheCaller(void* returnAddress);
 HMODULE GetCallerModule(void* returnAddress);
+KnownModule GetCallerModuleId(void* returnAddress);
+void ModuleFreed(void* module);
 MonitorInfo GetMonitorInfoForWindow(HWND hwnd);
 MonitorInfo GetMonitorInfoForOutput(IDXGIOutput* pOutput);
 int GetActiveRefreshRate(HWND hwnd);
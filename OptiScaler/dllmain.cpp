@@ -1513,7 +1513,7 @@ DWORD WINAPI InitThread(LPVOID hModuleVoid)
 {
     HMODULE hModule = (HMODULE) hModuleVoid;
 
-    auto detectedGpus = IdentifyGpu::getAllGpus();
+    const auto& detectedGpus = IdentifyGpu::getAllGpus();
     spdlog::info("Detected GPUs:");
     for (auto& gpu : detectedGpus)
     {
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Decides if a tagged FG input (depth, motion vectors) needs a snapshot copy or can be used directly until present.
+// Fed with the game's binding stream: tags, writes (barriers that change the resource) and command list executions.
+// Writes are resolved in execution order, a write executed after the tag's command list is a write after tag.
+// A slot is clean for a frame when its tag was executed, a write before the tag was seen (proves the game's writes
+// are visible to us) and nothing wrote it after the tag. Copies are only elided after StableFrames clean frames
+// in a row, every write after an elided tag is a strike and MaxStrikes disables elision for the slot.
+// Doesn't depend on D3D12, resources and command lists are only compared by pointer.
+template <typename Resource, typename CommandList, uint32_t SlotCount> class FGCopyElision
+{
+  public:
+    static constexpr uint32_t StableFrames = 16;
+    static constexpr uint32_t MaxStrikes = 3;
+    static constexpr size_t MaxPendingLists = 64;
+
+    enum class Outcome : uint32_t
+    {
+        None,     // Slot wasn't tagged
+        Clean,    // No write after tag
+        Written,  // Written after tag while a copy was made
+        Violated, // Written after tag while the copy was elided
+        Unknown   // Tag wasn't executed or game writes weren't visible
+    };
+
+  private:
+    struct Slot
+    {
+        Resource* resource = nullptr;
+        CommandList* tagList = nullptr;
+        bool tagged = false;
+        bool tagExecuted = false;
+        bool seen = false;
+        bool written = false;
+        bool elided = false;
+        uint32_t cleanFrames = 0;
+        uint32_t strikes = 0;
+    };
+
+    std::mutex _mutex;
+    Slot _slots[SlotCount] {};
+    std::atomic<Resource*> _watched[SlotCount] {};
+
+    // Writes recorded on command lists which are not executed yet, slot bits per list
+    std::vector<std::pair<CommandList*, uint32_t>> _pending;
+    std::atomic<bool> _hasPending = false;
+    std::atomic<bool> _waitingTag = false;
+
+    void ResolveWrite(Slot& slot)
+    {
+        if (slot.tagged && slot.tagExecuted)
+            slot.written = true;
+        else
+            slot.seen = true;
+    }
+
+    // Removes the slot bits of the list, returns true if any of them was set
+    bool ClearPending(CommandList* cmdList, uint32_t mask)
+    {
+        for (size_t i = 0; i < _pending.size(); i++)
+        {
+            if (_pending[i].first != cmdList)
+                continue;
+
+            auto found = (_pending[i].second & mask) != 0;
+            _pending[i].second &= ~mask;
+
+            if (_pending[i].second == 0)
+            {
+                _pending[i] = _pending.back();
+                _pending.pop_back();
+            }
+
+            _hasPending.store(!_pending.empty(), std::memory_order_release);
+            return found;
+        }
+
+        return false;
+    }
+
+  public:
+    // Lock free lookup for the barrier hook, -1 if the resource isn't tagged
+    int SlotOf(Resource* resource) const
+    {
+        if (resource == nullptr)
+            return -1;
+
+        for (uint32_t i = 0; i < SlotCount; i++)
+        {
+            if (_watched[i].load(std::memory_order_relaxed) == resource)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    bool HasWatched() const
+    {
+        for (uint32_t i = 0; i < SlotCount; i++)
+        {
+            if (_watched[i].load(std::memory_order_relaxed) != nullptr)
+                return true;
+        }
+
+        return false;
+    }
+
+    // Resource is tagged on cmdList, returns true if it needs a copy.
+    // allowElision is false when writes after the tag might be invisible (writable or common state at tag time).
+    bool Tag(uint32_t slotIndex, Resource* resource, CommandList* cmdList, bool allowElision)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto& slot = _slots[slotIndex];
+
+        if (slot.resource != resource)
+        {
+            slot.resource = resource;
+            slot.cleanFrames = 0;
+            slot.seen = false;
+            _watched[slotIndex].store(resource, std::memory_order_relaxed);
+        }
+
+        // Writes recorded on the tag list before the tag execute before it
+        if (ClearPending(cmdList, 1u << slotIndex))
+            slot.seen = true;
+
+        // A later tag in the same frame replaces the earlier one
+        slot.tagList = cmdList;
+        slot.tagged = true;
+        slot.tagExecuted = false;
+        slot.written = false;
+        slot.elided = allowElision && slot.strikes < MaxStrikes && slot.cleanFrames >= StableFrames;
+        _waitingTag.store(true, std::memory_order_release);
+
+        return !slot.elided;
+    }
+
+    // Resource transitioned to a writable state on cmdList
+    void Write(Resource* resource, CommandList* cmdList)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        uint32_t mask = 0;
+
+        for (uint32_t i = 0; i < SlotCount; i++)
+        {
+            if (_slots[i].resource == resource)
+                mask |= 1u << i;
+        }
+
+        if (mask == 0)
+            return;
+
+        for (auto& [list, listMask] : _pending)
+        {
+            if (list == cmdList)
+            {
+                listMask |= mask;
+                return;
+            }
+        }
+
+        // Too many lists in flight, resolve them now as writes after tag to stay on the safe side
+        if (_pending.size() >= MaxPendingLists)
+        {
+            for (auto& slot : _slots)
+            {
+                if (slot.tagged)
+                    slot.written = true;
+            }
+
+            _pending.clear();
+        }
+
+        _pending.emplace_back(cmdList, mask);
+        _hasPending.store(true, std::memory_order_release);
+    }
+
+    // Command lists submitted to a queue, in submission order
+    void Executed(CommandList* const* cmdLists, uint32_t count)
+    {
+        if (!_waitingTag.load(std::memory_order_acquire) && !_hasPending.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        bool waitingTag = false;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            auto cmdList = cmdLists[i];
+
+            for (auto& slot : _slots)
+            {
+                if (slot.tagged && !slot.tagExecuted && slot.tagList == cmdList)
+                    slot.tagExecuted = true;
+            }
+
+            for (size_t p = 0; p < _pending.size(); p++)
+            {
+                if (_pending[p].first != cmdList)
+                    continue;
+
+                for (uint32_t s = 0; s < SlotCount; s++)
+                {
+                    if ((_pending[p].second & (1u << s)) != 0)
+                        ResolveWrite(_slots[s]);
+                }
+
+                _pending[p] = _pending.back();
+                _pending.pop_back();
+                break;
+            }
+        }
+
+        for (auto& slot : _slots)
+            waitingTag |= slot.tagged && !slot.tagExecuted;
+
+        _waitingTag.store(waitingTag, std::memory_order_release);
+        _hasPending.store(!_pending.empty(), std::memory_order_release);
+    }
+
+    // Frame was presented, FG consumed the tagged resources
+    Outcome Present(uint32_t slotIndex)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto& slot = _slots[slotIndex];
+        auto outcome = Outcome::None;
+
+        if (slot.tagged)
+        {
+            if (slot.written)
+            {
+                outcome = slot.elided ? Outcome::Violated : Outcome::Written;
+                slot.cleanFrames = 0;
+
+                if (slot.elided)
+                    slot.strikes++;
+            }
+            else if (slot.tagExecuted && slot.seen)
+            {
+                outcome = Outcome::Clean;
+
+                if (slot.cleanFrames < StableFrames)
+                    slot.cleanFrames++;
+            }
+            else
+            {
+                outcome = Outcome::Unknown;
+                slot.cleanFrames = 0;
+            }
+        }
+
+        slot.tagList = nullptr;
+        slot.tagged = false;
+        slot.tagExecuted = false;
+        slot.seen = false;
+        slot.written = false;
+        slot.elided = false;
+
+        return outcome;
+    }
+
+    bool Disabled(uint32_t slotIndex)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _slots[slotIndex].strikes >= MaxStrikes;
+    }
+
+    void Reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (uint32_t i = 0; i < SlotCount; i++)
+        {
+            _slots[i] = {};
+            _watched[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        _pending.clear();
+        _hasPending.store(false, std::memory_order_release);
+        _waitingTag.store(false, std::memory_order_release);
+    }
+};
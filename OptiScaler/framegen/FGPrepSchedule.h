@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+
+enum class FGQueue : uint32_t
+{
+    Game,
+    Prep
+};
+
+// Fence scheduling of FG input preparation on OptiScaler's own compute queue.
+// Prep work of a frame slot waits for the game queue work submitted before it, and game queue work
+// which reads the prepared resources waits for the prep queue only when Consume is called.
+// A slot can be recorded again once the prep fence passed its last submission.
+// Queue calls go through Dispatch so this doesn't depend on D3D12:
+//   void Signal(FGQueue queue, uint64_t value)
+//   void Wait(FGQueue queue, FGQueue signaler, uint64_t value)
+//   void Execute(FGQueue queue, uint32_t slot)
+//   uint64_t Completed(FGQueue queue)
+template <uint32_t SlotCount> class FGPrepSchedule
+{
+    uint64_t _gameValue = 0;
+    uint64_t _prepValue = 0;
+    uint64_t _consumedValue = 0;
+    uint64_t _slotValues[SlotCount] {};
+    bool _recording[SlotCount] {};
+
+  public:
+    bool IsRecording(uint32_t slot) const { return _recording[slot]; }
+
+    // Returns false while the GPU still runs the last submission of the slot
+    template <typename Dispatch> bool BeginRecording(uint32_t slot, Dispatch& dispatch)
+    {
+        if (_recording[slot])
+            return true;
+
+        if (dispatch.Completed(FGQueue::Prep) < _slotValues[slot])
+            return false;
+
+        _recording[slot] = true;
+        return true;
+    }
+
+    // Recording failed, nothing will be submitted for the slot
+    void CancelRecording(uint32_t slot) { _recording[slot] = false; }
+
+    template <typename Dispatch> bool Submit(uint32_t slot, Dispatch& dispatch)
+    {
+        if (!_recording[slot])
+            return false;
+
+        _recording[slot] = false;
+
+        dispatch.Signal(FGQueue::Game, ++_gameValue);
+        dispatch.Wait(FGQueue::Prep, FGQueue::Game, _gameValue);
+        dispatch.Execute(FGQueue::Prep, slot);
+        dispatch.Signal(FGQueue::Prep, ++_prepValue);
+
+        _slotValues[slot] = _prepValue;
+        return true;
+    }
+
+    // Game queue work submitted after this sees every submitted prep result
+    template <typename Dispatch> void Consume(Dispatch& dispatch)
+    {
+        if (_consumedValue == _prepValue)
+            return;
+
+        dispatch.Wait(FGQueue::Game, FGQueue::Prep, _prepValue);
+        _consumedValue = _prepValue;
+    }
+
+    // Prep fence value after which none of the slots are in use
+    uint64_t LastValue() const { return _prepValue; }
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+// Order of OptiScaler's command lists on the game queue within a present
+enum class FGSubmitSlot : uint32_t
+{
+    UI,        // UI resource copies
+    Swapchain, // UI render and hudless compare on the swapchain buffer
+    FrameGen,  // FG prepare pass
+
+    COUNT
+};
+
+// Collects the command lists closed during a present and submits them with a single ExecuteCommandLists call.
+// Lists are submitted in slot order regardless of when they were added, lists of the same slot keep their order.
+// Doesn't depend on D3D12, submit is called as submit(List* lists, uint32_t count).
+template <typename List, uint32_t MaxPerSlot = 2> class FGSubmissionList
+{
+    static constexpr uint32_t SlotCount = static_cast<uint32_t>(FGSubmitSlot::COUNT);
+
+    List _lists[SlotCount][MaxPerSlot] {};
+    uint32_t _counts[SlotCount] {};
+
+  public:
+    // Returns false when the slot is full, caller should submit and add again
+    bool Add(FGSubmitSlot slot, List list)
+    {
+        auto& count = _counts[static_cast<uint32_t>(slot)];
+
+        if (count == MaxPerSlot)
+            return false;
+
+        _lists[static_cast<uint32_t>(slot)][count++] = list;
+        return true;
+    }
+
+    bool HasPending() const
+    {
+        for (uint32_t i = 0; i < SlotCount; i++)
+        {
+            if (_counts[i] > 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    // Returns the number of submitted lists
+    template <typename SubmitFunc> uint32_t Submit(SubmitFunc&& submit)
+    {
+        List ordered[SlotCount * MaxPerSlot] {};
+        uint32_t count = 0;
+
+        for (uint32_t i = 0; i < SlotCount; i++)
+        {
+            for (uint32_t j = 0; j < _counts[i]; j++)
+                ordered[count++] = _lists[i][j];
+
+            _counts[i] = 0;
+        }
+
+        if (count > 0)
+            submit(ordered, count);
+
+        return count;
+    }
+};
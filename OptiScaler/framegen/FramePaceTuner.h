@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// Tunes the frame pacing parameters of the FSR-FG swapchain from the observed output instead of hand tuned values.
+// Fed once per game frame with the presents displayed since the previous one and evaluated per window of frames.
+// Judder (uneven displayed intervals or presents which weren't displayed) raises safety margin and variance factor,
+// steady windows lower them slowly again but not back to a level which juddered.
+// Hybrid spin is tried while pacing is steady and kept only if it saves CPU time without judder,
+// its spin time is raised when it judders later.
+// Pure component, samples are fed by the caller and nothing here depends on Windows or graphics APIs.
+class FramePaceTuner
+{
+  public:
+    struct Params
+    {
+        float safetyMargin = 0.01f; // ms
+        float varianceFactor = 0.3f;
+        bool hybridSpin = false;
+        uint32_t hybridSpinTime = 2;
+
+        bool operator==(const Params& other) const = default;
+    };
+
+    struct Settings
+    {
+        uint32_t windowFrames = 120;
+        float minSafetyMargin = 0.01f;
+        float maxSafetyMargin = 2.0f;
+        float minVarianceFactor = 0.1f;
+        float maxVarianceFactor = 0.8f;
+        uint32_t minSpinTime = 2;
+        uint32_t maxSpinTime = 10;
+        float maxJitter = 0.15f;        // Coefficient of variation of displayed intervals
+        float maxMissed = 0.02f;        // Fraction of expected presents which weren't displayed
+        uint32_t relaxWindows = 5;      // Steady windows before parameters are lowered
+        float minSpinSaving = 0.1f;     // CPU cores hybrid spin has to save to be kept
+        uint32_t spinRetryWindows = 60; // Windows before a rejected hybrid spin is tried again
+        double maxFrameTime = 250.0;    // Longer frames are loading screens or hitches, ignored
+    };
+
+    enum class Verdict : uint32_t
+    {
+        None,
+        Steady,
+        Judder
+    };
+
+  private:
+    Settings _settings {};
+    Params _params {};
+
+    // Window accumulators
+    uint32_t _frames = 0;
+    uint32_t _samples = 0;
+    double _sum = 0.0;
+    double _sumSquares = 0.0;
+    uint64_t _expected = 0;
+    uint64_t _displayed = 0;
+    double _wallTime = 0.0;
+    double _cpuTime = 0.0;
+
+    Verdict _lastVerdict = Verdict::None;
+    uint32_t _steadyWindows = 0;
+    uint32_t _spinCooldown = 0;
+    bool _spinTrial = false;
+    double _spinBaseline = 0.0;
+    double _lastCpuCores = 0.0;
+
+    // Lowest parameters which juddered
+    float _marginFloor = 0.0f;
+    float _varianceFloor = 0.0f;
+
+    void ClearWindow()
+    {
+        _frames = 0;
+        _samples = 0;
+        _sum = 0.0;
+        _sumSquares = 0.0;
+        _expected = 0;
+        _displayed = 0;
+        _wallTime = 0.0;
+        _cpuTime = 0.0;
+    }
+
+    void Clamp()
+    {
+        _params.safetyMargin = std::clamp(_params.safetyMargin, _settings.minSafetyMargin, _settings.maxSafetyMargin);
+        _params.varianceFactor =
+            std::clamp(_params.varianceFactor, _settings.minVarianceFactor, _settings.maxVarianceFactor);
+        _params.hybridSpinTime = std::clamp(_params.hybridSpinTime, _settings.minSpinTime, _settings.maxSpinTime);
+    }
+
+    void RejectSpin()
+    {
+        _params.hybridSpin = false;
+        _spinCooldown = _settings.spinRetryWindows;
+    }
+
+    void Judder()
+    {
+        _steadyWindows = 0;
+
+        if (_params.hybridSpin)
+        {
+            // Sleeping too long overshoots the present time
+            _params.hybridSpinTime += 2;
+
+            if (_params.hybridSpinTime > _settings.maxSpinTime)
+            {
+                _params.hybridSpinTime = _settings.minSpinTime;
+                RejectSpin();
+            }
+
+            return;
+        }
+
+        _marginFloor = std::max(_marginFloor, _params.safetyMargin);
+        _varianceFloor = std::max(_varianceFloor, _params.varianceFactor);
+
+        _params.safetyMargin = std::max(_params.safetyMargin * 2.0f, _params.safetyMargin + 0.05f);
+        _params.varianceFactor += 0.1f;
+    }
+
+    void Steady()
+    {
+        _steadyWindows++;
+
+        if (_spinCooldown > 0)
+            _spinCooldown--;
+
+        if (_steadyWindows < _settings.relaxWindows)
+            return;
+
+        _steadyWindows = 0;
+
+        if (!_params.hybridSpin && _spinCooldown == 0)
+        {
+            _spinTrial = true;
+            _spinBaseline = _lastCpuCores;
+            _params.hybridSpin = true;
+            return;
+        }
+
+        // Lower safety margin first, it adds latency to every frame
+        auto margin = std::max({ _params.safetyMargin * 0.8f, _marginFloor * 1.25f, _settings.minSafetyMargin });
+
+        if (margin < _params.safetyMargin)
+        {
+            _params.safetyMargin = margin;
+            return;
+        }
+
+        auto variance =
+            std::max({ _params.varianceFactor - 0.05f, _varianceFloor + 0.05f, _settings.minVarianceFactor });
+
+        if (variance < _params.varianceFactor)
+        {
+            _params.varianceFactor = variance;
+            return;
+        }
+
+        // Blocked by an old judder, let the floors go down slowly so a changed scene can be probed again
+        _marginFloor *= 0.9f;
+        _varianceFloor *= 0.9f;
+    }
+
+  public:
+    void Configure(const Settings& settings)
+    {
+        _settings = settings;
+
+        if (_settings.windowFrames == 0)
+            _settings.windowFrames = 1;
+
+        Clamp();
+    }
+
+    const Settings& GetSettings() const { return _settings; }
+
+    // Starts from the given parameters, usually the configured ones
+    void Reset(const Params& params)
+    {
+        _params = params;
+        Clamp();
+        ClearWindow();
+
+        _lastVerdict = Verdict::None;
+        _steadyWindows = 0;
+        _spinCooldown = params.hybridSpin ? _settings.spinRetryWindows : 0;
+        _spinTrial = false;
+        _spinBaseline = 0.0;
+        _lastCpuCores = 0.0;
+        _marginFloor = 0.0f;
+        _varianceFloor = 0.0f;
+    }
+
+    // frameTime: time between game presents in ms
+    // displayed, displayTime: presents displayed since the previous game present and the time they covered in ms
+    // expected: presents expected for a game frame (real + generated)
+    // cpuTime: CPU time used by the process during the frame in ms (all threads)
+    // Returns true when the parameters are changed at the end of a window
+    bool Frame(double frameTime, uint32_t displayed, double displayTime, uint32_t expected, double cpuTime)
+    {
+        if (frameTime <= 0.0 || frameTime > _settings.maxFrameTime || expected == 0)
+            return false;
+
+        _frames++;
+        _expected += expected;
+        _displayed += displayed;
+        _wallTime += frameTime;
+        _cpuTime += std::max(cpuTime, 0.0);
+
+        // Displayed interval relative to the ideal one, 1.0 when generated and real frames are evenly paced
+        if (displayed > 0 && displayTime > 0.0)
+        {
+            auto ratio = (displayTime / displayed) / (frameTime / expected);
+            _samples++;
+            _sum += ratio;
+            _sumSquares += ratio * ratio;
+        }
+
+        if (_frames < _settings.windowFrames)
+            return false;
+
+        auto previous = _params;
+
+        auto missed = _displayed < _expected ? (double) (_expected - _displayed) / (double) _expected : 0.0;
+        auto jitter = 0.0;
+
+        if (_samples > 1 && _sum > 0.0)
+        {
+            auto mean = _sum / _samples;
+            auto variance = std::max(_sumSquares / _samples - mean * mean, 0.0);
+            jitter = std::sqrt(variance) / mean;
+        }
+
+        _lastCpuCores = _wallTime > 0.0 ? _cpuTime / _wallTime : 0.0;
+        _lastVerdict = (jitter > _settings.maxJitter || missed > _settings.maxMissed) ? Verdict::Judder
+                                                                                     : Verdict::Steady;
+        ClearWindow();
+
+        if (_spinTrial)
+        {
+            _spinTrial = false;
+
+            if (_lastVerdict == Verdict::Judder || _spinBaseline - _lastCpuCores < _settings.minSpinSaving)
+                RejectSpin();
+        }
+        else if (_lastVerdict == Verdict::Judder)
+        {
+            Judder();
+        }
+        else
+        {
+            Steady();
+        }
+
+        Clamp();
+
+        return !(_params == previous);
+    }
+
+    const Params& GetParams() const { return _params; }
+    Verdict LastVerdict() const { return _lastVerdict; }
+    double CpuCores() const { return _lastCpuCores; }
+    bool IsTryingSpin() const { return _spinTrial; }
+};
@@ -47,7 +47,7 @@ UINT64 IFGFeature::StartNewFrame()
     auto fIndex = GetIndex();
     LOG_DEBUG("_frameCount: {}, fIndex: {}", _frameCount, fIndex);
 
-    _resourceReady[fIndex].clear();
+    _resourceReady[fIndex].store(0, std::memory_order_relaxed);
     _waitingExecute[fIndex] = false;
 
     _noUi[fIndex] = true;
@@ -64,7 +64,15 @@ bool IFGFeature::IsResourceReady(FG_ResourceType type, int index)
     if (index < 0)
         index = GetIndex();
 
-    return _resourceReady[index].contains(type);
+    return (_resourceReady[index].load(std::memory_order_acquire) & FGResourceBit(type)) != 0;
+}
+
+bool IFGFeature::AreResourcesReady(uint32_t mask, int index)
+{
+    if (index < 0)
+        index = GetIndex();
+
+    return (_resourceReady[index].load(std::memory_order_acquire) & mask) == mask;
 }
 
 bool IFGFeature::WaitingExecution(int index)
@@ -310,7 +318,7 @@ void IFGFeature::SetResourceReady(FG_ResourceType type, int index)
     if (index < 0)
         index = GetIndex();
 
-    _resourceReady[index][type] = true;
+    _resourceReady[index].fetch_or(FGResourceBit(type), std::memory_order_release);
     _resourceFrame[type] = _frameCount;
 }
 
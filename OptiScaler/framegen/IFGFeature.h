@@ -1,6 +1,7 @@
 #pragma once
 #include "SysUtils.h"
 #include <OwnedMutex.h>
+#include <atomic>
 #include <dxgi1_6.h>
 #include <flag-set-cpp/flag_set.hpp>
 
@@ -35,6 +36,10 @@ enum FG_ResourceType : uint32_t
     ResourceTypeCOUNT
 };
 
+static_assert(FG_ResourceType::ResourceTypeCOUNT <= 32, "FG_ResourceType must fit into a 32 bit mask");
+
+constexpr uint32_t FGResourceBit(FG_ResourceType type) { return 1u << static_cast<uint32_t>(type); }
+
 enum class FG_ResourceValidity : uint32_t
 {
     ValidNow = 0,
@@ -79,8 +84,9 @@ class IFGFeature
     UINT64 _targetFrame = 0;
     FG_Constants _constants {};
 
-    std::unordered_map<FG_ResourceType, bool> _resourceReady[BUFFER_COUNT] {};
-    std::unordered_map<FG_ResourceType, UINT64> _resourceFrame {};
+    // One bit per FG_ResourceType, set from ExecuteCommandLists hooks and cleared on new frame
+    std::atomic<uint32_t> _resourceReady[BUFFER_COUNT] {};
+    UINT64 _resourceFrame[FG_ResourceType::ResourceTypeCOUNT] {};
 
     bool _noHudless[BUFFER_COUNT] = { true, true, true, true };
     bool _noUi[BUFFER_COUNT] = { true, true, true, true };
@@ -113,6 +119,7 @@ class IFGFeature
     UINT64 StartNewFrame();
 
     bool IsResourceReady(FG_ResourceType type, int index = -1);
+    bool AreResourcesReady(uint32_t mask, int index = -1);
 
     bool IsUsingUI();
     bool IsUsingUIAny(); // Same as IsUsingUI but checks if at least once buffer has UI
@@ -2,9 +2,32 @@
 #include "IFGFeature_Dx12.h"
 #include <State.h>
 #include <Config.h>
+#include <resource_tracking/ResourceDesc_Dx12.h>
+#include <resource_tracking/PrepStateCheck_Dx12.h>
 
 #include <magic_enum.hpp>
 
+// Connects FGPrepSchedule to the game and prep queues
+struct PrepQueueDispatch
+{
+    ID3D12CommandQueue* gameQueue;
+    ID3D12CommandQueue* prepQueue;
+    ID3D12Fence* gameFence;
+    ID3D12Fence* prepFence;
+    ID3D12GraphicsCommandList** prepLists;
+
+    ID3D12CommandQueue* Queue(FGQueue queue) { return queue == FGQueue::Game ? gameQueue : prepQueue; }
+    ID3D12Fence* Fence(FGQueue queue) { return queue == FGQueue::Game ? gameFence : prepFence; }
+
+    void Signal(FGQueue queue, uint64_t value) { Queue(queue)->Signal(Fence(queue), value); }
+    void Wait(FGQueue queue, FGQueue signaler, uint64_t value) { Queue(queue)->Wait(Fence(signaler), value); }
+    void Execute(FGQueue queue, uint32_t slot)
+    {
+        Queue(queue)->ExecuteCommandLists(1, (ID3D12CommandList**) &prepLists[slot]);
+    }
+    uint64_t Completed(FGQueue queue) { return Fence(queue)->GetCompletedValue(); }
+};
+
 bool IFGFeature_Dx12::GetResourceCopy(FG_ResourceType type, D3D12_RESOURCE_STATES bufferState, ID3D12Resource* output)
 {
     if (!InitCopyCmdList())
@@ -156,6 +179,163 @@ ID3D12GraphicsCommandList* IFGFeature_Dx12::GetSCCommandList(int index)
     return _scCommandList[index];
 }
 
+// Returns a command list on OptiScaler's compute queue to prepare the resource,
+// nullptr when the work has to be recorded inline
+ID3D12GraphicsCommandList* IFGFeature_Dx12::GetPrepCommandList(int index, const Dx12Resource* resource)
+{
+    if (!Config::Instance()->FGAsyncPrep.value_or_default())
+        return nullptr;
+
+    // Barriers of the prep list use the state of the tag, it's only checked at submit with the barrier hook
+    if (_prepStateViolated || !PrepStateCheck_Dx12::IsEnabled())
+        return nullptr;
+
+    // Prep work runs after the game submitted the frame, input has to stay valid until then
+    if (resource->validity != FG_ResourceValidity::UntilPresent &&
+        resource->validity != FG_ResourceValidity::UntilPresentFromDispatch)
+    {
+        return nullptr;
+    }
+
+    // States which can't be used on a compute queue
+    constexpr auto computeStates = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE |
+                                   D3D12_RESOURCE_STATE_UNORDERED_ACCESS | D3D12_RESOURCE_STATE_COPY_SOURCE |
+                                   D3D12_RESOURCE_STATE_COPY_DEST;
+
+    if ((resource->state & ~computeStates) != 0)
+        return nullptr;
+
+    std::lock_guard<std::mutex> prepLock(_prepMutex);
+
+    if (!InitPrepQueue())
+        return nullptr;
+
+    if (_prepSchedule.IsRecording(index))
+    {
+        PrepStateCheck_Dx12::Watch(index, resource->resource, resource->state);
+        return _prepCommandList[index];
+    }
+
+    PrepQueueDispatch dispatch { _gameCommandQueue, _prepQueue, _gameFence, _prepFence, _prepCommandList };
+
+    if (!_prepSchedule.BeginRecording(index, dispatch))
+    {
+        LOG_DEBUG("_prepCommandList[{}] is still in use, recording inline", index);
+        return nullptr;
+    }
+
+    auto result = _prepCommandAllocator[index]->Reset();
+
+    if (result == S_OK)
+        result = _prepCommandList[index]->Reset(_prepCommandAllocator[index], nullptr);
+
+    if (result != S_OK)
+    {
+        LOG_ERROR("_prepCommandList[{}] reset error: {:X}", index, (UINT) result);
+        _prepSchedule.CancelRecording(index);
+        return nullptr;
+    }
+
+    PrepStateCheck_Dx12::Watch(index, resource->resource, resource->state);
+
+    return _prepCommandList[index];
+}
+
+void IFGFeature_Dx12::QueueCommandList(FGSubmitSlot slot, ID3D12GraphicsCommandList* cmdList)
+{
+    if (!_pendingSubmits.Add(slot, cmdList))
+    {
+        SubmitCommandLists();
+        _pendingSubmits.Add(slot, cmdList);
+    }
+}
+
+// Closes the UI and swapchain lists of the frame, they are executed with the FG list by SubmitCommandLists
+void IFGFeature_Dx12::QueuePresentCommandLists(int index)
+{
+    // Game submitted the frame, prep queue can start on the inputs
+    {
+        std::unique_lock<std::shared_mutex> lock(_resourceMutex[index]);
+        std::lock_guard<std::mutex> prepLock(_prepMutex);
+
+        if (_prepSchedule.IsRecording(index))
+        {
+            LOG_DEBUG("Executing _prepCommandList[{}]: {:X}", index, (size_t) _prepCommandList[index]);
+            auto closeResult = _prepCommandList[index]->Close();
+            auto stateValid = PrepStateCheck_Dx12::Verify(index);
+
+            if (closeResult == S_OK && stateValid)
+            {
+                PrepQueueDispatch dispatch { _gameCommandQueue, _prepQueue, _gameFence, _prepFence,
+                                             _prepCommandList };
+                _prepSchedule.Submit(index, dispatch);
+            }
+            else if (closeResult == S_OK)
+            {
+                // Barriers of the list don't match the inputs anymore, the frame uses the last prepared ones
+                LOG_WARN("FG input transitioned after its tag, preparing inputs inline from now on");
+                _prepSchedule.CancelRecording(index);
+                _prepStateViolated = true;
+            }
+            else
+            {
+                LOG_ERROR("_prepCommandList[{}]->Close() error: {:X}", index, (UINT) closeResult);
+                _prepSchedule.CancelRecording(index);
+            }
+        }
+    }
+
+    if (_uiCommandListResetted[index])
+    {
+        LOG_DEBUG("Queueing _uiCommandList[{}]: {:X}", index, (size_t) _uiCommandList[index]);
+        auto closeResult = _uiCommandList[index]->Close();
+
+        if (closeResult == S_OK)
+            QueueCommandList(FGSubmitSlot::UI, _uiCommandList[index]);
+        else
+            LOG_ERROR("_uiCommandList[{}]->Close() error: {:X}", index, (UINT) closeResult);
+
+        _uiCommandListResetted[index] = false;
+    }
+
+    if (_scCommandListResetted[index])
+    {
+        LOG_DEBUG("Queueing _scCommandList[{}]: {:X}", index, (size_t) _scCommandList[index]);
+        auto closeResult = _scCommandList[index]->Close();
+
+        if (closeResult == S_OK)
+            QueueCommandList(FGSubmitSlot::Swapchain, _scCommandList[index]);
+        else
+            LOG_ERROR("_scCommandList[{}]->Close() error: {:X}", index, (UINT) closeResult);
+
+        _scCommandListResetted[index] = false;
+    }
+}
+
+void IFGFeature_Dx12::SubmitCommandLists()
+{
+    // FG dispatch reads the prepared inputs even when no UI or swapchain lists are queued
+    {
+        std::lock_guard<std::mutex> prepLock(_prepMutex);
+
+        if (_prepQueue != nullptr)
+        {
+            PrepQueueDispatch dispatch { _gameCommandQueue, _prepQueue, _gameFence, _prepFence, _prepCommandList };
+            _prepSchedule.Consume(dispatch);
+        }
+    }
+
+    if (!_pendingSubmits.HasPending())
+        return;
+
+    _pendingSubmits.Submit(
+        [this](ID3D12CommandList** lists, uint32_t count)
+        {
+            LOG_DEBUG("Executing {} command lists", count);
+            _gameCommandQueue->ExecuteCommandLists(count, lists);
+        });
+}
+
 Dx12Resource* IFGFeature_Dx12::GetResource(FG_ResourceType type, int index)
 {
     if (index < 0)
@@ -239,7 +419,11 @@ void IFGFeature_Dx12::FlipResource(Dx12Resource* resource)
 
     if (flip->get()->IsInit())
     {
-        auto cmdList = (resource->cmdList != nullptr) ? resource->cmdList : GetUICommandList(fIndex);
+        auto cmdList = GetPrepCommandList(fIndex, resource);
+
+        if (cmdList == nullptr)
+            cmdList = (resource->cmdList != nullptr) ? resource->cmdList : GetUICommandList(fIndex);
+
         auto result = flip->get()->Dispatch(_device, (ID3D12GraphicsCommandList*) cmdList, resource->resource,
                                             flipOutput, resource->width, resource->height, true);
 
@@ -259,7 +443,7 @@ bool IFGFeature_Dx12::CreateBufferResourceWithSize(ID3D12Device* device, ID3D12R
     if (device == nullptr || source == nullptr)
         return false;
 
-    auto inDesc = source->GetDesc();
+    auto inDesc = ResourceDesc_Dx12::Get(source);
 
     if (UAV)
         inDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
@@ -378,6 +562,128 @@ void IFGFeature_Dx12::DestroyCopyCmdList()
     }
 }
 
+bool IFGFeature_Dx12::InitPrepQueue()
+{
+    if (_prepQueue != nullptr)
+        return true;
+
+    if (_prepQueueFailed || _device == nullptr || _gameCommandQueue == nullptr)
+        return false;
+
+    // Don't try again every frame
+    _prepQueueFailed = true;
+
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COMPUTE;
+    queueDesc.Priority = D3D12_COMMAND_QUEUE_PRIORITY_NORMAL;
+    queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+
+    auto result = _device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&_prepQueue));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateCommandQueue _prepQueue: {:X}", (unsigned long) result);
+        _prepQueue = nullptr;
+        return false;
+    }
+
+    _prepQueue->SetName(L"_prepQueue");
+
+    result = _device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&_gameFence));
+    if (result == S_OK)
+        result = _device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&_prepFence));
+
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateFence: {:X}", (unsigned long) result);
+        DestroyPrepQueue();
+        return false;
+    }
+
+    ID3D12CommandAllocator* allocator = nullptr;
+    ID3D12GraphicsCommandList* cmdList = nullptr;
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++)
+    {
+        result = _device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COMPUTE,
+                                                 IID_PPV_ARGS(&_prepCommandAllocator[i]));
+        if (result != S_OK)
+        {
+            LOG_ERROR("_prepCommandAllocator: {:X}", (unsigned long) result);
+            DestroyPrepQueue();
+            return false;
+        }
+
+        _prepCommandAllocator[i]->SetName(L"_prepCommandAllocator");
+        if (CheckForRealObject(__FUNCTION__, _prepCommandAllocator[i], (IUnknown**) &allocator))
+            _prepCommandAllocator[i] = allocator;
+
+        result = _device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COMPUTE, _prepCommandAllocator[i], NULL,
+                                            IID_PPV_ARGS(&_prepCommandList[i]));
+        if (result != S_OK)
+        {
+            LOG_ERROR("_prepCommandList: {:X}", (unsigned long) result);
+            DestroyPrepQueue();
+            return false;
+        }
+
+        _prepCommandList[i]->SetName(L"_prepCommandList");
+        if (CheckForRealObject(__FUNCTION__, _prepCommandList[i], (IUnknown**) &cmdList))
+            _prepCommandList[i] = cmdList;
+
+        result = _prepCommandList[i]->Close();
+        if (result != S_OK)
+        {
+            LOG_ERROR("_prepCommandList->Close: {:X}", (unsigned long) result);
+            DestroyPrepQueue();
+            return false;
+        }
+    }
+
+    LOG_INFO("Created FG prep compute queue");
+    _prepQueueFailed = false;
+    return true;
+}
+
+void IFGFeature_Dx12::DestroyPrepQueue()
+{
+    // Resources might still be in use by the prep queue
+    if (_prepFence != nullptr && _prepFence->GetCompletedValue() < _prepSchedule.LastValue())
+        _prepFence->SetEventOnCompletion(_prepSchedule.LastValue(), nullptr);
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++)
+    {
+        if (_prepCommandAllocator[i] != nullptr)
+        {
+            _prepCommandAllocator[i]->Release();
+            _prepCommandAllocator[i] = nullptr;
+        }
+
+        if (_prepCommandList[i] != nullptr)
+        {
+            _prepCommandList[i]->Release();
+            _prepCommandList[i] = nullptr;
+        }
+    }
+
+    if (_gameFence != nullptr)
+    {
+        _gameFence->Release();
+        _gameFence = nullptr;
+    }
+
+    if (_prepFence != nullptr)
+    {
+        _prepFence->Release();
+        _prepFence = nullptr;
+    }
+
+    if (_prepQueue != nullptr)
+    {
+        _prepQueue->Release();
+        _prepQueue = nullptr;
+    }
+}
+
 bool IFGFeature_Dx12::CreateBufferResource(ID3D12Device* device, ID3D12Resource* source,
                                            D3D12_RESOURCE_STATES initialState, ID3D12Resource** target, bool UAV,
                                            bool depth)
@@ -385,7 +691,7 @@ bool IFGFeature_Dx12::CreateBufferResource(ID3D12Device* device, ID3D12Resource*
     if (device == nullptr || source == nullptr)
         return false;
 
-    auto inDesc = source->GetDesc();
+    auto inDesc = ResourceDesc_Dx12::Get(source);
 
     if (UAV)
         inDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
@@ -1,6 +1,8 @@
 #pragma once
 #include "SysUtils.h"
 #include "IFGFeature.h"
+#include "FGSubmission.h"
+#include "FGPrepSchedule.h"
 
 #include <upscalers/IFeature.h>
 
@@ -40,6 +42,22 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     bool InitCopyCmdList();
     void DestroyCopyCmdList();
 
+    // Optional compute queue for FG input preparation
+    ID3D12CommandQueue* _prepQueue = nullptr;
+    ID3D12Fence* _gameFence = nullptr;
+    ID3D12Fence* _prepFence = nullptr;
+    ID3D12GraphicsCommandList* _prepCommandList[BUFFER_COUNT] {};
+    ID3D12CommandAllocator* _prepCommandAllocator[BUFFER_COUNT] {};
+    FGPrepSchedule<BUFFER_COUNT> _prepSchedule;
+    bool _prepQueueFailed = false;
+    bool _prepStateViolated = false; // Game transitioned a prepared input after its tag, prepare inline
+
+    // Guards the prep queue and schedule, callers of GetPrepCommandList already hold _resourceMutex[index]
+    std::mutex _prepMutex;
+
+    bool InitPrepQueue();
+    void DestroyPrepQueue();
+
   protected:
     ID3D12Device* _device = nullptr;
     IDXGISwapChain* _swapChain = nullptr;
@@ -67,6 +85,9 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     std::unique_ptr<HC_Dx12> _hudlessCompare;
     std::unique_ptr<RUI_Dx12> _renderUI;
 
+    // Command lists waiting to be executed on the game queue
+    FGSubmissionList<ID3D12CommandList*> _pendingSubmits;
+
     bool CreateBufferResource(ID3D12Device* InDevice, ID3D12Resource* InSource, D3D12_RESOURCE_STATES InState,
                               ID3D12Resource** OutResource, bool UAV = false, bool depth = false);
     bool CreateBufferResourceWithSize(ID3D12Device* device, ID3D12Resource* source, D3D12_RESOURCE_STATES state,
@@ -76,6 +97,11 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     bool CopyResource(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource** target,
                       D3D12_RESOURCE_STATES sourceState);
 
+    ID3D12GraphicsCommandList* GetPrepCommandList(int index, const Dx12Resource* resource);
+    void QueueCommandList(FGSubmitSlot slot, ID3D12GraphicsCommandList* cmdList);
+    void QueuePresentCommandLists(int index);
+    void SubmitCommandLists();
+
     void NewFrame() override final;
     void FlipResource(Dx12Resource* resource);
 
@@ -110,5 +136,9 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     bool HasResource(FG_ResourceType type, int index = -1) override final;
 
     IFGFeature_Dx12() = default;
-    virtual ~IFGFeature_Dx12() { DestroyCopyCmdList(); }
+    virtual ~IFGFeature_Dx12()
+    {
+        DestroyPrepQueue();
+        DestroyCopyCmdList();
+    }
 };
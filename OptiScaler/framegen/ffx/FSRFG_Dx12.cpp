@@ -4,6 +4,8 @@
 #include <State.h>
 
 #include <hudfix/Hudfix_Dx12.h>
+#include <resource_tracking/ResourceDesc_Dx12.h>
+#include <resource_tracking/CopyElision_Dx12.h>
 #include <menu/menu_overlay_dx.h>
 
 #include <magic_enum.hpp>
@@ -254,6 +256,15 @@ void FSRFG_Dx12::ConfigureFramePaceTuning()
         fpt.safetyMarginInMs = Config::Instance()->FGFPTSafetyMarginInMs.value_or_default();
         fpt.varianceFactor = Config::Instance()->FGFPTVarianceFactor.value_or_default();
 
+        if (_paceTunerActive)
+        {
+            auto& params = _paceTuner.GetParams();
+            fpt.allowHybridSpin = params.hybridSpin;
+            fpt.hybridSpinTime = params.hybridSpinTime;
+            fpt.safetyMarginInMs = params.safetyMargin;
+            fpt.varianceFactor = params.varianceFactor;
+        }
+
         ffxConfigureDescFrameGenerationSwapChainKeyValueDX12 cfgDesc {};
         cfgDesc.header.type = FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_KEYVALUE_DX12;
         cfgDesc.key = 2; // FfxSwapchainFramePacingTuning
@@ -264,6 +275,84 @@ void FSRFG_Dx12::ConfigureFramePaceTuning()
     }
 }
 
+void FSRFG_Dx12::UpdateFramePaceTuner()
+{
+    auto config = Config::Instance();
+
+    if (!config->FGFPTAutoTune.value_or_default() || !config->FGFramePacingTuning.value_or_default() ||
+        _swapChain == nullptr || Version() < feature_version { 3, 1, 3 })
+    {
+        // Back to the configured values
+        if (_paceTunerActive)
+        {
+            _paceTunerActive = false;
+            State::Instance().FSRFGFTPchanged = true;
+        }
+
+        return;
+    }
+
+    if (!_paceTunerActive)
+    {
+        FramePaceTuner::Params params {};
+        params.safetyMargin = config->FGFPTSafetyMarginInMs.value_or_default();
+        params.varianceFactor = config->FGFPTVarianceFactor.value_or_default();
+        params.hybridSpin = config->FGFPTAllowHybridSpin.value_or_default();
+        params.hybridSpinTime = (uint32_t) std::max(config->FGFPTHybridSpinTime.value_or_default(), 0);
+
+        _paceTuner.Reset(params);
+        _paceTunerActive = true;
+        _hasFrameStats = false;
+        State::Instance().FSRFGFTPchanged = true;
+    }
+
+    DXGI_FRAME_STATISTICS stats {};
+    FILETIME creationTime {};
+    FILETIME exitTime {};
+    FILETIME kernelTime {};
+    FILETIME userTime {};
+
+    // Statistics are not available while the swapchain isn't presenting to the screen
+    if (_swapChain->GetFrameStatistics(&stats) != S_OK ||
+        !GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        _hasFrameStats = false;
+        return;
+    }
+
+    // In 100ns units
+    auto cpuTime = ((uint64_t) kernelTime.dwHighDateTime << 32 | kernelTime.dwLowDateTime) +
+                   ((uint64_t) userTime.dwHighDateTime << 32 | userTime.dwLowDateTime);
+
+    if (_hasFrameStats && stats.PresentCount >= _lastFrameStats.PresentCount &&
+        stats.SyncQPCTime.QuadPart >= _lastFrameStats.SyncQPCTime.QuadPart)
+    {
+        static LARGE_INTEGER frequency {};
+
+        if (frequency.QuadPart == 0)
+            QueryPerformanceFrequency(&frequency);
+
+        auto displayed = stats.PresentCount - _lastFrameStats.PresentCount;
+        auto displayTime =
+            1000.0 * (double) (stats.SyncQPCTime.QuadPart - _lastFrameStats.SyncQPCTime.QuadPart) / frequency.QuadPart;
+
+        // FSR-FG presents a generated and a real frame for each game frame
+        if (_paceTuner.Frame(State::Instance().presentFrameTime, displayed, displayTime, 2,
+                             (double) (cpuTime - _lastCpuTime) / 10000.0))
+        {
+            auto& params = _paceTuner.GetParams();
+            LOG_DEBUG("Frame pacing tuned, safety margin: {:.3f}, variance factor: {:.2f}, hybrid spin: {} ({})",
+                      params.safetyMargin, params.varianceFactor, params.hybridSpin, params.hybridSpinTime);
+
+            State::Instance().FSRFGFTPchanged = true;
+        }
+    }
+
+    _lastFrameStats = stats;
+    _lastCpuTime = cpuTime;
+    _hasFrameStats = true;
+}
+
 feature_version FSRFG_Dx12::Version()
 {
 
@@ -297,32 +386,39 @@ bool FSRFG_Dx12::Dispatch()
 {
     LOG_FUNC();
 
+    // Next pace tuner sample would cover all the frames without FG
     if (_fgContext == nullptr)
     {
         LOG_DEBUG("No fg context");
+        _hasFrameStats = false;
         return false;
     }
 
     UINT64 willDispatchFrame = 0;
     auto fIndex = GetDispatchIndex(willDispatchFrame);
     if (fIndex < 0)
+    {
+        _hasFrameStats = false;
         return false;
+    }
 
     if (!IsActive() || IsPaused())
+    {
+        _hasFrameStats = false;
         return false;
+    }
 
     auto& state = State::Instance();
     auto config = Config::Instance();
 
+    UpdateFramePaceTuner();
+
     if (state.FSRFGFTPchanged)
         ConfigureFramePaceTuning();
 
     LOG_DEBUG("_frameCount: {}, willDispatchFrame: {}, fIndex: {}", _frameCount, willDispatchFrame, fIndex);
 
-    if (!_resourceReady[fIndex].contains(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].contains(FG_ResourceType::Velocity) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Velocity))
+    if (!AreResourcesReady(FGResourceBit(FG_ResourceType::Depth) | FGResourceBit(FG_ResourceType::Velocity), fIndex))
     {
         LOG_WARN("Depth or Velocity is not ready, skipping");
         return false;
@@ -1274,7 +1370,8 @@ bool FSRFG_Dx12::ExecuteCommandList(int index)
     if (_waitingExecute[index])
     {
         LOG_DEBUG("Executing FG cmdList: {:X}", (size_t) _fgCommandList[index]);
-        _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_fgCommandList[index]);
+        QueueCommandList(FGSubmitSlot::FrameGen, _fgCommandList[index]);
+        SubmitCommandLists();
         SetExecuted(index);
     }
 
@@ -1382,7 +1479,7 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
         auto scFfxFormat =
             (FfxApiSurfaceFormat) ffxApiGetSurfaceFormatDX12(State::Instance().currentSwapchainDesc.BufferDesc.Format);
 
-        auto resFormat = fResource->GetResource()->GetDesc().Format;
+        auto resFormat = ResourceDesc_Dx12::Get(fResource->GetResource()).Format;
         _lastHudlessFormat = (FfxApiSurfaceFormat) ffxApiGetSurfaceFormatDX12(resFormat);
 
         if (_lastHudlessFormat != FFX_API_SURFACE_FORMAT_UNKNOWN && !CompareResourceFormats(resFormat, scFormat))
@@ -1413,6 +1510,15 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
                               ? FG_ResourceValidity::UntilPresent
                               : FG_ResourceValidity::ValidNow;
 
+    // Upscaler inputs are tagged every frame, skip the copy if the game doesn't write them before present
+    if (fResource->validity == FG_ResourceValidity::ValidNow &&
+        State::Instance().activeFgInput == FGInput::Upscaler &&
+        !CopyElision_Dx12::NeedsCopy(type, inputResource->resource, inputResource->cmdList, inputResource->state))
+    {
+        LOG_TRACE("Skipping copy of: {}", magic_enum::enum_name(type));
+        fResource->validity = FG_ResourceValidity::UntilPresent;
+    }
+
     // Copy ValidNow
     if (fResource->validity == FG_ResourceValidity::ValidNow)
     {
@@ -1622,42 +1728,24 @@ bool FSRFG_Dx12::Present()
 
     // if (IsActive() && !IsPaused())
     {
-        if (_uiCommandListResetted[fIndex])
-        {
-            LOG_DEBUG("Executing _uiCommandList[{}]: {:X}", fIndex, (size_t) _uiCommandList[fIndex]);
-            auto closeResult = _uiCommandList[fIndex]->Close();
-
-            if (closeResult == S_OK)
-                _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_uiCommandList[fIndex]);
-            else
-                LOG_ERROR("_uiCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
-
-            _uiCommandListResetted[fIndex] = false;
-        }
-
-        if (_scCommandListResetted[fIndex])
-        {
-            LOG_DEBUG("Executing _scCommandList[{}]: {:X}", fIndex, (size_t) _scCommandList[fIndex]);
-            auto closeResult = _scCommandList[fIndex]->Close();
-
-            if (closeResult == S_OK)
-                _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_scCommandList[fIndex]);
-            else
-                LOG_ERROR("_scCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
-
-            _scCommandListResetted[fIndex] = false;
-        }
+        QueuePresentCommandLists(fIndex);
     }
 
     if ((_fgFramePresentId - _lastFGFramePresentId) > 3 && IsActive() && !_waitingNewFrameData)
     {
         LOG_DEBUG("Pausing FG");
+        SubmitCommandLists();
         Deactivate();
         _waitingNewFrameData = true;
+        _hasFrameStats = false;
         return false;
     }
 
     _fgFramePresentId++;
 
-    return Dispatch();
+    // UI and swapchain lists are submitted with the FG list, unless Dispatch returned before queueing it
+    auto dispatched = Dispatch();
+    SubmitCommandLists();
+
+    return dispatched;
 }
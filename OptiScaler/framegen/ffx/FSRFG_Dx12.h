@@ -1,6 +1,7 @@
 #pragma once
 #include "SysUtils.h"
 #include <framegen/IFGFeature_Dx12.h>
+#include <framegen/FramePaceTuner.h>
 #include <proxies/FfxApi_Proxy.h>
 #include <shaders/format_transfer/FT_Dx12.h>
 #include <shaders/hud_copy/HudCopy_Dx12.h>
@@ -29,6 +30,13 @@ class FSRFG_Dx12 : public virtual IFGFeature_Dx12
     ID3D12GraphicsCommandList* _fgCommandList[BUFFER_COUNT] {};
     ID3D12CommandAllocator* _fgCommandAllocator[BUFFER_COUNT] {};
 
+    // Frame pacing auto tuning
+    FramePaceTuner _paceTuner;
+    bool _paceTunerActive = false;
+    bool _hasFrameStats = false;
+    DXGI_FRAME_STATISTICS _lastFrameStats {};
+    uint64_t _lastCpuTime = 0;
+
     static FfxApiResourceState GetFfxApiState(D3D12_RESOURCE_STATES state)
     {
         switch (state)
@@ -61,6 +69,7 @@ class FSRFG_Dx12 : public virtual IFGFeature_Dx12
     bool ExecuteCommandList(int index);
     bool Dispatch();
     void ConfigureFramePaceTuning();
+    void UpdateFramePaceTuner();
     bool HudlessFormatTransfer(int index, ID3D12Device* device, DXGI_FORMAT targetFormat, Dx12Resource* resource);
     bool UIFormatTransfer(int index, ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, DXGI_FORMAT targetFormat,
                           Dx12Resource* resource);
@@ -698,10 +698,7 @@ bool XeFG_Dx12::Dispatch()
 
     LOG_DEBUG("_frameCount: {}, willDispatchFrame: {}, fIndex: {}", _frameCount, willDispatchFrame, fIndex);
 
-    if (!_resourceReady[fIndex].contains(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].contains(FG_ResourceType::Velocity) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Velocity))
+    if (!AreResourcesReady(FGResourceBit(FG_ResourceType::Depth) | FGResourceBit(FG_ResourceType::Velocity), fIndex))
     {
         LOG_WARN("Depth or Velocity is not ready, skipping");
         return false;
@@ -1242,36 +1239,13 @@ bool XeFG_Dx12::Present()
 
     // if (IsActive() && !IsPaused())
     {
-        if (_uiCommandListResetted[fIndex])
-        {
-            LOG_DEBUG("Executing _uiCommandList[{}]: {:X}", fIndex, (size_t) _uiCommandList[fIndex]);
-            auto closeResult = _uiCommandList[fIndex]->Close();
-
-            if (closeResult == S_OK)
-                _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_uiCommandList[fIndex]);
-            else
-                LOG_ERROR("_uiCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
-
-            _uiCommandListResetted[fIndex] = false;
-        }
-
-        if (_scCommandListResetted[fIndex])
-        {
-            LOG_DEBUG("Executing _scCommandList[{}]: {:X}", fIndex, (size_t) _scCommandList[fIndex]);
-            auto closeResult = _scCommandList[fIndex]->Close();
-
-            if (closeResult == S_OK)
-                _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_scCommandList[fIndex]);
-            else
-                LOG_ERROR("_scCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
-
-            _scCommandListResetted[fIndex] = false;
-        }
+        QueuePresentCommandLists(fIndex);
     }
 
     if ((_fgFramePresentId - _lastFGFramePresentId) > 3 && IsActive() && !_waitingNewFrameData)
     {
         LOG_DEBUG("Pausing FG");
+        SubmitCommandLists();
         Deactivate();
         _waitingNewFrameData = true;
         return false;
@@ -1279,6 +1253,8 @@ bool XeFG_Dx12::Present()
 
     _fgFramePresentId++;
 
+    SubmitCommandLists();
+
     return Dispatch();
 }
 
@@ -1401,7 +1377,10 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
                                                    fResource->height, fResource->state) &&
                 _depthInvert->Buffer() != nullptr)
             {
-                auto cmdList = (fResource->cmdList != nullptr) ? fResource->cmdList : GetUICommandList(fIndex);
+                auto cmdList = GetPrepCommandList(fIndex, fResource);
+
+                if (cmdList == nullptr)
+                    cmdList = (fResource->cmdList != nullptr) ? fResource->cmdList : GetUICommandList(fIndex);
 
                 _depthInvert->SetBufferState(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 
@@ -1457,7 +1436,7 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
         if (type == FG_ResourceType::HudlessColor)
         {
             static DXGI_FORMAT lastFormat[BUFFER_COUNT] = {};
-            auto desc = fResource->GetResource()->GetDesc();
+            auto desc = ResourceDesc_Dx12::Get(fResource->GetResource());
 
             if (lastFormat[fIndex] != DXGI_FORMAT_UNKNOWN && lastFormat[fIndex] != desc.Format)
             {
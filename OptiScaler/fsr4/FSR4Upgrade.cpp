@@ -394,7 +394,7 @@ struct AmdExtD3DFactory : public IAmdExtD3DFactory
 
 void InitFSR4Update()
 {
-    auto primaryGpu = IdentifyGpu::getPrimaryGpu();
+    const auto& primaryGpu = IdentifyGpu::getPrimaryGpu();
     if (!primaryGpu.fsr4Capable)
         return;
 
@@ -374,7 +374,7 @@ static HRESULT hkD3D12CreateDevice(IDXGIAdapter* pAdapter, D3D_FEATURE_LEVEL Min
             szName = desc.Description;
             LOG_INFO("Adapter Desc: {}", wstring_to_string(szName));
 
-            auto primaryGpu = IdentifyGpu::getPrimaryGpu();
+            const auto& primaryGpu = IdentifyGpu::getPrimaryGpu();
             if (!IsEqualLUID(desc.AdapterLuid, primaryGpu.luid))
                 LOG_WARN("D3D12Device created with non-primary GPU");
         }
@@ -507,7 +507,7 @@ static HRESULT hkCreateDevice(ID3D12DeviceFactory* pFactory, IDXGIAdapter* pAdap
             szName = desc.Description;
             LOG_INFO("Adapter Desc: {}", wstring_to_string(szName));
 
-            auto primaryGpu = IdentifyGpu::getPrimaryGpu();
+            const auto& primaryGpu = IdentifyGpu::getPrimaryGpu();
             if (!IsEqualLUID(desc.AdapterLuid, primaryGpu.luid))
                 LOG_WARN("D3D12Device created with non-primary GPU");
         }
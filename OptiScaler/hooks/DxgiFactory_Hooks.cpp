@@ -852,7 +852,7 @@ HRESULT DxgiFactoryHooks::EnumAdapters(IDXGIFactory* realFactory, UINT Adapter,
     IDXGIFactory6* factory6 = nullptr;
     if (realFactory->QueryInterface(IID_PPV_ARGS(&factory6)) == S_OK && factory6 != nullptr)
     {
-        auto allGpus = IdentifyGpu::getAllGpus();
+        const auto& allGpus = IdentifyGpu::getAllGpus();
         if (Adapter < allGpus.size())
         {
             LOG_DEBUG("Trying to select: {}", allGpus[Adapter].name);
@@ -900,7 +900,7 @@ HRESULT DxgiFactoryHooks::EnumAdapters1(IDXGIFactory1* realFactory, UINT Adapter
     IDXGIFactory6* factory6 = nullptr;
     if (realFactory->QueryInterface(IID_PPV_ARGS(&factory6)) == S_OK && factory6 != nullptr)
     {
-        auto allGpus = IdentifyGpu::getAllGpus();
+        const auto& allGpus = IdentifyGpu::getAllGpus();
         if (Adapter < allGpus.size())
         {
             LOG_DEBUG("Trying to select: {}", allGpus[Adapter].name);
@@ -740,7 +740,7 @@ HRESULT DxgiFactoryWrappedCalls::EnumAdapters(IDXGIFactory* realFactory, UINT Ad
     IDXGIFactory6* factory6 = nullptr;
     if (realFactory->QueryInterface(IID_PPV_ARGS(&factory6)) == S_OK && factory6 != nullptr)
     {
-        auto allGpus = IdentifyGpu::getAllGpus();
+        const auto& allGpus = IdentifyGpu::getAllGpus();
         if (Adapter < allGpus.size())
         {
             LOG_DEBUG("Trying to select: {}", allGpus[Adapter].name);
@@ -785,7 +785,7 @@ HRESULT DxgiFactoryWrappedCalls::EnumAdapters1(IDXGIFactory1* realFactory, UINT
     IDXGIFactory6* factory6 = nullptr;
     if (realFactory->QueryInterface(IID_PPV_ARGS(&factory6)) == S_OK && factory6 != nullptr)
     {
-        auto allGpus = IdentifyGpu::getAllGpus();
+        const auto& allGpus = IdentifyGpu::getAllGpus();
         if (Adapter < allGpus.size())
         {
             LOG_DEBUG("Trying to select: {}", allGpus[Adapter].name);
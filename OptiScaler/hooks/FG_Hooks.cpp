@@ -12,6 +12,7 @@
 #include <resource_tracking/ResTrack_Dx12.h>
 
 #include <misc/FrameLimit.h>
+#include <upscalers/RenderScaleGovernor.h>
 #include <upscaler_time/UpscalerTime_Dx12.h>
 
 #include <detours/detours.h>
@@ -1035,6 +1036,7 @@ HRESULT FGHooks::FGPresent(void* This, UINT SyncInterval, UINT Flags, const DXGI
 
         _lastFGFrameTime = now;
         State::Instance().lastFGFrameTime = ftDelta;
+        RenderScaleGovernor::FrameTime(ftDelta);
 
         LOG_DEBUG("flags: {:X}, Frametime: {}", Flags, ftDelta);
     }
@@ -1067,6 +1069,9 @@ HRESULT FGHooks::FGPresent(void* This, UINT SyncInterval, UINT Flags, const DXGI
         // And if Optiscalers FG is active call
         // FG Features present
         fg->Present();
+
+        // Depth & MV tags of the frame are consumed
+        CopyElision_Dx12::Present();
     }
 
     if (willPresent)
@@ -14,6 +14,7 @@
 
 #include <cwctype>
 #include <misc/IdentifyGpu.h>
+#include <misc/NameHash.h>
 
 #pragma intrinsic(_ReturnAddress)
 
@@ -84,6 +85,30 @@ static inline HMODULE CheckLoad(const std::wstring& name)
     return nullptr;
 }
 
+static constexpr NameHash AmdExtD3DCreateInterfaceName("AmdExtD3DCreateInterface");
+static constexpr NameHash D3DKMTEnumAdapters2Name("D3DKMTEnumAdapters2");
+
+HMODULE KernelHooks::CachedModule(std::atomic<HMODULE>& cache, LPCWSTR name)
+{
+    auto generation = _moduleGeneration.load(std::memory_order_acquire);
+
+    if (_cachedModuleGeneration.load(std::memory_order_acquire) != generation)
+    {
+        _gdi32Module.store(nullptr, std::memory_order_relaxed);
+        _cachedModuleGeneration.store(generation, std::memory_order_release);
+    }
+
+    auto module = cache.load(std::memory_order_acquire);
+
+    if (module == nullptr)
+    {
+        module = KernelBaseProxy::GetModuleHandleW_()(name);
+        cache.store(module, std::memory_order_release);
+    }
+
+    return module;
+}
+
 FARPROC WINAPI KernelHooks::hk_K32_GetProcAddress(HMODULE hModule, LPCSTR lpProcName)
 {
 
@@ -104,16 +129,15 @@ FARPROC WINAPI KernelHooks::hk_K32_GetProcAddress(HMODULE hModule, LPCSTR lpProc
     // FSR 4 Init in case of missing amdxc64.dll
     // 2nd check is amdxcffx64.dll trying to queue amdxc64 but amdxc64 not being loaded.
     // Also skip the internal call of amdxc64
-    if (lpProcName != nullptr && (hModule == amdxc64Mark || hModule == nullptr) &&
-        lstrcmpA(lpProcName, "AmdExtD3DCreateInterface") == 0 && IdentifyGpu::getPrimaryGpu().fsr4Capable &&
-        Util::GetCallerModule(_ReturnAddress()) != KernelBaseProxy::GetModuleHandleW_()(L"amdxc64.dll"))
+    if ((hModule == amdxc64Mark || hModule == nullptr) && AmdExtD3DCreateInterfaceName.Matches(lpProcName) &&
+        IdentifyGpu::getPrimaryGpu().fsr4Capable &&
+        Util::GetCallerModuleId(_ReturnAddress()) != KnownModule::Amdxc64)
     {
         return (FARPROC) &hkAmdExtD3DCreateInterface;
     }
 
-    if (State::Instance().isRunningOnLinux && lpProcName != nullptr &&
-        hModule == KernelBaseProxy::GetModuleHandleW_()(L"gdi32.dll") &&
-        lstrcmpA(lpProcName, "D3DKMTEnumAdapters2") == 0)
+    if (State::Instance().isRunningOnLinux && hModule != nullptr &&
+        hModule == CachedModule(_gdi32Module, L"gdi32.dll") && D3DKMTEnumAdapters2Name.Matches(lpProcName))
     {
         return (FARPROC) &customD3DKMTEnumAdapters2;
     }
@@ -183,9 +207,8 @@ FARPROC WINAPI KernelHooks::hk_KB_GetProcAddress(HMODULE hModule, LPCSTR lpProcN
     //               Util::WhoIsTheCaller(_ReturnAddress()));
     // }
 
-    if (State::Instance().isRunningOnLinux && lpProcName != nullptr &&
-        hModule == KernelBaseProxy::GetModuleHandleW_()(L"gdi32.dll") &&
-        lstrcmpA(lpProcName, "D3DKMTEnumAdapters2") == 0)
+    if (State::Instance().isRunningOnLinux && hModule != nullptr &&
+        hModule == CachedModule(_gdi32Module, L"gdi32.dll") && D3DKMTEnumAdapters2Name.Matches(lpProcName))
         return (FARPROC) &customD3DKMTEnumAdapters2;
 
     return o_KB_GetProcAddress(hModule, lpProcName);
@@ -353,5 +376,8 @@ BOOL KernelHooks::hk_K32_FreeLibrary(HMODULE lpLibrary)
             return result.value() == TRUE;
     }
 
-    return o_K32_FreeLibrary(lpLibrary);
+    auto freed = o_K32_FreeLibrary(lpLibrary);
+    Util::ModuleFreed(lpLibrary);
+
+    return freed;
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include "SysUtils.h"
 
+#include <atomic>
+
 #include <proxies/Kernel32_Proxy.h>
 #include <proxies/KernelBase_Proxy.h>
 
@@ -39,6 +41,14 @@ class KernelHooks
 
     static constexpr HMODULE amdxc64Mark = HMODULE(0xFFFFFFFF13372137);
 
+    // Handles of modules GetProcAddress hooks are interested in
+    // Loaded handles are kept until a library is loaded or freed, missing ones are looked up again when needed
+    inline static std::atomic<HMODULE> _gdi32Module = nullptr;
+    inline static std::atomic<uint32_t> _moduleGeneration = 0;
+    inline static std::atomic<uint32_t> _cachedModuleGeneration = 0;
+
+    static HMODULE CachedModule(std::atomic<HMODULE>& cache, LPCWSTR name);
+
     static FARPROC WINAPI hk_K32_GetProcAddress(HMODULE hModule, LPCSTR lpProcName);
     static HMODULE WINAPI hk_K32_GetModuleHandleA(LPCSTR lpModuleName);
     static BOOL WINAPI hk_K32_GetModuleHandleExW(DWORD dwFlags, LPCWSTR lpModuleName, HMODULE* phModule);
@@ -59,6 +69,9 @@ class KernelHooks
     static inline std::mutex hookMutexBase;
 
   public:
+    // Called from LibraryLoad hooks when a library is loaded or freed
+    static void ModulesChanged() { _moduleGeneration.fetch_add(1, std::memory_order_release); }
+
     static void Hook()
     {
         std::lock_guard<std::mutex> lock(hookMutex32);
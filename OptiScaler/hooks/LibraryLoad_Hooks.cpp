@@ -23,6 +23,7 @@
 #include <hooks/D3D12_Hooks.h>
 #include <hooks/Vulkan_Hooks.h>
 #include <hooks/Gdi32_Hooks.h>
+#include <hooks/Kernel_Hooks.h>
 #include <hooks/Streamline_Hooks.h>
 
 #include <fsr4/FSR4ModelSelection.h>
@@ -38,6 +39,8 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckA(std::string libName, LPCSTR lpLibFul
 
 HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibFullPath)
 {
+    KernelHooks::ModulesChanged();
+
     auto libNameA = wstring_to_string(libName);
 
 #ifdef LOG_LIB_OPERATIONS
@@ -480,6 +483,8 @@ std::optional<NTSTATUS> LibraryLoadHooks::FreeLibrary(PVOID lpLibrary)
 {
     std::optional<NTSTATUS> result;
 
+    KernelHooks::ModulesChanged();
+
     if (lpLibrary == dllModule)
     {
 #ifdef LOG_LIB_OPERATIONS
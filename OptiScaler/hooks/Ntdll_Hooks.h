@@ -155,7 +155,10 @@ class NtdllHooks
                 return result.value();
         }
 
-        return o_LdrUnloadDll(lpLibrary);
+        auto status = o_LdrUnloadDll(lpLibrary);
+        Util::ModuleFreed(lpLibrary);
+
+        return status;
     }
 
   public:
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+
+enum TimingType : uint32_t
+{
+    TimeRange, // in ns, value stored in length
+    Simulation,
+    RenderSubmit,
+    Present,
+    Driver,
+    OsRenderQueue,
+    GpuRender,
+
+    TimingTypeCOUNT
+};
+
+// Normalized values, position + length <= 1
+struct TimingEntry
+{
+    double position;
+    double length;
+};
+
+struct TimingSpan
+{
+    uint64_t start;
+    uint64_t end;
+};
+
+// Start and end times of a frame report in TimingType order, TimeRange is unused
+// Works with both NVAPI's frame report and fakenvapi's FrameReport
+template <typename Report> void GetTimingSpans(const Report& report, TimingSpan (&spans)[TimingTypeCOUNT])
+{
+    spans[TimingType::TimeRange] = {};
+    spans[TimingType::Simulation] = { report.simStartTime, report.simEndTime };
+    spans[TimingType::RenderSubmit] = { report.renderSubmitStartTime, report.renderSubmitEndTime };
+    spans[TimingType::Present] = { report.presentStartTime, report.presentEndTime };
+    spans[TimingType::Driver] = { report.driverStartTime, report.driverEndTime };
+    spans[TimingType::OsRenderQueue] = { report.osRenderQueueStartTime, report.osRenderQueueEndTime };
+    spans[TimingType::GpuRender] = { report.gpuRenderStartTime, report.gpuRenderEndTime };
+}
+
+// Normalizes the spans to the whole frame, returns false when there are no timestamps
+inline bool ReduceTimingSpans(const TimingSpan (&spans)[TimingTypeCOUNT],
+                              std::optional<TimingEntry> (&timings)[TimingTypeCOUNT])
+{
+    uint64_t start = UINT64_MAX;
+    uint64_t end = 0;
+
+    for (uint32_t i = TimingType::Simulation; i < TimingTypeCOUNT; i++)
+    {
+        for (auto time : { spans[i].start, spans[i].end })
+        {
+            if (time == 0)
+                continue;
+
+            if (time < start)
+                start = time;
+
+            if (time > end)
+                end = time;
+        }
+    }
+
+    if (end < start)
+        return false;
+
+    double rangeNs = static_cast<double>(end - start);
+    timings[TimingType::TimeRange] = TimingEntry { .position = 0, .length = rangeNs };
+
+    for (uint32_t i = TimingType::Simulation; i < TimingTypeCOUNT; i++)
+    {
+        auto& span = spans[i];
+
+        // Missing markers or a zero length range
+        if (span.start == 0 || span.end < span.start || rangeNs <= 0.0)
+        {
+            timings[i].reset();
+            continue;
+        }
+
+        timings[i] = TimingEntry { .position = (double) (span.start - start) / rangeNs,
+                                   .length = (double) (span.end - span.start) / rangeNs };
+    }
+
+    return true;
+}
+
+template <typename Report>
+bool ReduceFrameReport(const Report& report, std::optional<TimingEntry> (&timings)[TimingTypeCOUNT])
+{
+    TimingSpan spans[TimingTypeCOUNT];
+    GetTimingSpans(report, spans);
+
+    return ReduceTimingSpans(spans, timings);
+}
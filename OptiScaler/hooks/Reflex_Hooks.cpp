@@ -285,28 +285,36 @@ void* ReflexHooks::getHookedReflex(unsigned int InterfaceId)
     return nullptr;
 }
 
-#define UPDATE_TIMING_ENTRY(name, type)                                                                                \
-    if (frameReport.name##EndTime >= frameReport.name##StartTime)                                                      \
-    {                                                                                                                  \
-        double name##Pos = (double) (frameReport.name##StartTime - start) / rangeNs;                                   \
-        double name##Length = (double) (frameReport.name##EndTime - frameReport.name##StartTime) / rangeNs;            \
-        timingData[TimingType::type] = TimingEntry { .position = name##Pos, .length = name##Length };                  \
-    }                                                                                                                  \
-    else                                                                                                               \
-    {                                                                                                                  \
-        timingData[TimingType::type].reset();                                                                          \
-    }
-
 bool ReflexHooks::updateTimingData()
 {
-    bool canCall = ((State::Instance().activeFgOutput == FGOutput::XeFG && !fakenvapi::isUsingAsMainNvapi() &&
-                     !Config::Instance()->XeFGWithoutXeLL.value_or_default()) ||
-                    o_NvAPI_D3D_GetLatency);
+    const bool useFakenvapi = State::Instance().activeFgOutput == FGOutput::XeFG &&
+                              !fakenvapi::isUsingAsMainNvapi() &&
+                              !Config::Instance()->XeFGWithoutXeLL.value_or_default();
 
-    if (!canCall || !_lastSleepDev)
+    if ((!useFakenvapi && !o_NvAPI_D3D_GetLatency) || !_lastSleepDev)
         return false;
 
-    NV_LATENCY_RESULT_PARAMS results {};
+    if (useFakenvapi)
+    {
+        // Only ask for the newest completed report instead of the whole ring
+        FrameReport report {};
+        uint32_t count = 1;
+
+        if (nvapi_calls::Fake_GetFrameReports(_lastTimingFrameId, &report, &count) != NVAPI_OK)
+            return false;
+
+        // Nothing new since the last poll
+        if (count == 0)
+            return _hasTimingData;
+
+        _lastTimingFrameId = report.frameID;
+        _hasTimingData = ReduceFrameReport(report, timingData);
+
+        return _hasTimingData;
+    }
+
+    // Too big for the stack, only used from the overlay
+    static NV_LATENCY_RESULT_PARAMS results {};
     results.version = NV_LATENCY_RESULT_PARAMS_VER;
 
     if (auto result = hkNvAPI_D3D_GetLatency(_lastSleepDev, &results); result != NVAPI_OK)
@@ -315,38 +323,22 @@ bool ReflexHooks::updateTimingData()
     // 64th element have the latest data
     auto& frameReport = results.frameReport[63];
 
-    uint64_t start = UINT64_MAX;
-    uint64_t end = 0;
-
-    // Please don't look, just thought it would be least work
-    auto pTimes = (uint64_t*) &frameReport.simStartTime;
-    for (auto i = 0; i < 11; i++)
-    {
-        auto& time = pTimes[i];
-        if (time == 0)
-            continue;
+    if (frameReport.frameID == _lastTimingFrameId && _hasTimingData)
+        return true;
 
-        if (time < start)
-            start = time;
-
-        if (time > end)
-            end = time;
-    }
+    _lastTimingFrameId = frameReport.frameID;
+    _hasTimingData = ReduceFrameReport(frameReport, timingData);
 
-    if (end < start)
-        return false;
-
-    double rangeNs = static_cast<double>(end - start);
+    return _hasTimingData;
+}
 
-    timingData[TimingType::TimeRange] = TimingEntry { .position = 0, .length = rangeNs };
-    UPDATE_TIMING_ENTRY(sim, Simulation)
-    UPDATE_TIMING_ENTRY(renderSubmit, RenderSubmit)
-    UPDATE_TIMING_ENTRY(present, Present)
-    UPDATE_TIMING_ENTRY(driver, Driver)
-    UPDATE_TIMING_ENTRY(osRenderQueue, OsRenderQueue)
-    UPDATE_TIMING_ENTRY(gpuRender, GpuRender)
+void ReflexHooks::resetTimingData()
+{
+    _lastTimingFrameId = 0;
+    _hasTimingData = false;
 
-    return true;
+    for (auto& entry : timingData)
+        entry.reset();
 }
 
 // For updating information about Reflex hooks
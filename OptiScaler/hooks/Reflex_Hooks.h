@@ -1,26 +1,7 @@
 #pragma once
 #include <d3d12.h>
 #include <nvapi/NvApiTypes.h>
-
-enum TimingType : uint32_t
-{
-    TimeRange, // in ns, value stored in length
-    Simulation,
-    RenderSubmit,
-    Present,
-    Driver,
-    OsRenderQueue,
-    GpuRender,
-
-    TimingTypeCOUNT
-};
-
-// Normalized values, position + length <= 1
-struct TimingEntry
-{
-    double position;
-    double length;
-};
+#include "ReflexTimings.h"
 
 class ReflexHooks
 {
@@ -37,6 +18,10 @@ class ReflexHooks
 
     inline static std::thread::id _lastSetSleepThread {};
 
+    // Frame id of the report timingData was built from
+    inline static uint64_t _lastTimingFrameId = 0;
+    inline static bool _hasTimingData = false;
+
     // D3D
     inline static decltype(&NvAPI_D3D_SetSleepMode) o_NvAPI_D3D_SetSleepMode = nullptr;
     inline static decltype(&NvAPI_D3D_Sleep) o_NvAPI_D3D_Sleep = nullptr;
@@ -68,7 +53,9 @@ class ReflexHooks
     static void setDlssgDetectedState(bool state);
     static bool isReflexHooked();
     static void* getHookedReflex(unsigned int InterfaceId);
+    // Only reduces a new report when the game has finished a frame since the last call
     static bool updateTimingData();
+    static void resetTimingData();
 
     // For updating information about Reflex hooks
     static void update(bool optiFg_FgState, bool isVulkan);
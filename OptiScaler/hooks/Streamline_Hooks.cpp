@@ -158,6 +158,10 @@ sl::Result StreamlineHooks::hkslSetTag(sl::ViewportHandle& viewport, sl::Resourc
         return o_slSetTag(viewport, tags, numTags, cmdBuffer);
     }
 
+    auto& state = State::Instance();
+    auto fgInput = state.activeFgInput;
+    bool hudlessFix = static_cast<bool>(state.gameQuirks & GameQuirk::CyberpunkHudlessFixes);
+
     for (uint32_t i = 0; i < numTags; i++)
     {
         if (tags[i].resource == nullptr || tags[i].resource->native == nullptr)
@@ -167,27 +171,18 @@ sl::Result StreamlineHooks::hkslSetTag(sl::ViewportHandle& viewport, sl::Resourc
         }
 
         // Cyberpunk hudless state fix for RDNA 2
-        if (State::Instance().gameQuirks & GameQuirk::CyberpunkHudlessFixes &&
+        if (hudlessFix && tags[i].type == sl::kBufferTypeHUDLessColor &&
             tags[i].resource->state ==
-                (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) &&
-            tags[i].type == sl::kBufferTypeHUDLessColor)
+                (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE))
         {
             tags[i].resource->state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
             LOG_TRACE("Changing hudless resource state");
         }
 
-        if (State::Instance().activeFgInput == FGInput::DLSSG &&
-            (tags[i].type == sl::kBufferTypeHUDLessColor || tags[i].type == sl::kBufferTypeDepth ||
-             tags[i].type == sl::kBufferTypeHiResDepth || tags[i].type == sl::kBufferTypeLinearDepth ||
-             tags[i].type == sl::kBufferTypeMotionVectors || tags[i].type == sl::kBufferTypeUIColorAndAlpha ||
-             tags[i].type == sl::kBufferTypeBidirectionalDistortionField))
-        {
-            State::Instance().slFGInputs.reportResource(tags[i], (ID3D12GraphicsCommandList*) cmdBuffer, 0);
-        }
-        else if (State::Instance().activeFgInput == FGInput::Nukems)
-        {
+        if (fgInput == FGInput::DLSSG && SlFGBufferTypes.Contains(tags[i].type))
+            state.slFGInputs.reportResource(tags[i], (ID3D12GraphicsCommandList*) cmdBuffer, 0);
+        else if (fgInput == FGInput::Nukems)
             LOG_TRACE("Tagging resource of type: {}", tags[i].type);
-        }
     }
 
     auto result = o_slSetTag(viewport, tags, numTags, cmdBuffer);
@@ -215,6 +210,9 @@ sl::Result StreamlineHooks::hkslSetTagForFrame(const sl::FrameToken& frame, cons
 
     LOG_DEBUG("frameIndex: {}", static_cast<uint32_t>(frame));
 
+    auto& state = State::Instance();
+    auto fgInput = state.activeFgInput;
+
     for (uint32_t i = 0; i < numResources; i++)
     {
         if (resources[i].resource == nullptr || resources[i].resource->native == nullptr)
@@ -223,16 +221,11 @@ sl::Result StreamlineHooks::hkslSetTagForFrame(const sl::FrameToken& frame, cons
             continue;
         }
 
-        if (State::Instance().activeFgInput == FGInput::DLSSG &&
-            (resources[i].type == sl::kBufferTypeHUDLessColor || resources[i].type == sl::kBufferTypeDepth ||
-             resources[i].type == sl::kBufferTypeHiResDepth || resources[i].type == sl::kBufferTypeLinearDepth ||
-             resources[i].type == sl::kBufferTypeMotionVectors || resources[i].type == sl::kBufferTypeUIColorAndAlpha ||
-             resources[i].type == sl::kBufferTypeBidirectionalDistortionField))
+        if (fgInput == FGInput::DLSSG && SlFGBufferTypes.Contains(resources[i].type))
         {
-            State::Instance().slFGInputs.reportResource(resources[i], (ID3D12GraphicsCommandList*) cmdBuffer,
-                                                        (uint32_t) frame);
+            state.slFGInputs.reportResource(resources[i], (ID3D12GraphicsCommandList*) cmdBuffer, (uint32_t) frame);
         }
-        else if (State::Instance().activeFgInput == FGInput::Nukems)
+        else if (fgInput == FGInput::Nukems)
         {
             LOG_TRACE("Tagging resource of type: {}", resources[i].type);
         }
@@ -259,10 +252,7 @@ sl::Result StreamlineHooks::hkslEvaluateFeature(sl::Feature feature, const sl::F
             {
                 auto tag = (const sl::ResourceTag*) inputs[i];
 
-                if (tag->type == sl::kBufferTypeHUDLessColor || tag->type == sl::kBufferTypeDepth ||
-                    tag->type == sl::kBufferTypeHiResDepth || tag->type == sl::kBufferTypeLinearDepth ||
-                    tag->type == sl::kBufferTypeMotionVectors || tag->type == sl::kBufferTypeUIColorAndAlpha ||
-                    tag->type == sl::kBufferTypeBidirectionalDistortionField)
+                if (SlFGBufferTypes.Contains(tag->type))
                 {
                     State::Instance().slFGInputs.reportResource(*tag, (ID3D12GraphicsCommandList*) cmdBuffer,
                                                                 (uint32_t) frame);
@@ -34,8 +34,46 @@ static PFN_vkAllocateCommandBuffers o_vkAllocateCommandBuffers = nullptr;
 static PFN_vkDestroyCommandPool o_vkDestroyCommandPool = nullptr;
 static PFN_vkCreateCommandPool o_vkCreateCommandPool = nullptr;
 
+static PFN_vkCreateImage o_vkCreateImage = nullptr;
+static PFN_vkDestroyImage o_vkDestroyImage = nullptr;
+static PFN_vkAllocateMemory o_vkAllocateMemory = nullptr;
+static PFN_vkFreeMemory o_vkFreeMemory = nullptr;
+static PFN_vkBindImageMemory o_vkBindImageMemory = nullptr;
+
 static std::unordered_map<VkCommandPool, uint32_t> commandPoolToQueueFamilyMap;
 
+// Only images/memory created for external use are tracked, so these stay small
+typedef struct ExternalMemoryInfo
+{
+    VkExternalMemoryHandleTypeFlags HandleTypes = 0;
+    VkImage DedicatedImage = VK_NULL_HANDLE;
+} ExternalMemoryInfo;
+
+typedef struct ExternalImageInfo
+{
+    VkInterop::ImageInfo Info {};
+    VkDeviceMemory Memory = VK_NULL_HANDLE;
+} ExternalImageInfo;
+
+static std::mutex externalMemoryMutex;
+static std::unordered_map<VkImage, ExternalImageInfo> externalImages;
+static std::unordered_map<VkDeviceMemory, ExternalMemoryInfo> externalMemories;
+
+template <typename T> static const T* FindInChain(const void* pNext, VkStructureType sType)
+{
+    auto header = static_cast<const VkBaseInStructure*>(pNext);
+
+    while (header != nullptr)
+    {
+        if (header->sType == sType)
+            return reinterpret_cast<const T*>(header);
+
+        header = header->pNext;
+    }
+
+    return nullptr;
+}
+
 // #define LOG_ALL_RECORDS
 
 #ifndef LOG_ALL_RECORDS
@@ -6066,6 +6104,128 @@ VkResult hk_vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo*
     return result;
 }
 
+VkResult Vulkan_wDx12::hk_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                                        const VkAllocationCallbacks* pAllocator, VkImage* pImage)
+{
+    auto result = o_vkCreateImage(device, pCreateInfo, pAllocator, pImage);
+
+    if (result != VK_SUCCESS || pCreateInfo == nullptr || pImage == nullptr)
+        return result;
+
+    auto externalInfo = FindInChain<VkExternalMemoryImageCreateInfo>(
+        pCreateInfo->pNext, VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO);
+
+    if (externalInfo == nullptr || externalInfo->handleTypes == 0)
+        return result;
+
+    ExternalImageInfo image {};
+    image.Info.Format = pCreateInfo->format;
+    image.Info.Usage = pCreateInfo->usage;
+    image.Info.Tiling = pCreateInfo->tiling;
+    image.Info.Samples = pCreateInfo->samples;
+    image.Info.MipLevels = pCreateInfo->mipLevels;
+    image.Info.ArrayLayers = pCreateInfo->arrayLayers;
+    image.Info.ImageHandleTypes = externalInfo->handleTypes;
+
+    std::scoped_lock lock(externalMemoryMutex);
+    externalImages[*pImage] = image;
+
+    return result;
+}
+
+void Vulkan_wDx12::hk_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
+{
+    if (image != VK_NULL_HANDLE)
+    {
+        std::scoped_lock lock(externalMemoryMutex);
+        externalImages.erase(image);
+    }
+
+    o_vkDestroyImage(device, image, pAllocator);
+}
+
+VkResult Vulkan_wDx12::hk_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                           const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
+{
+    auto result = o_vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+
+    if (result != VK_SUCCESS || pAllocateInfo == nullptr || pMemory == nullptr)
+        return result;
+
+    auto exportInfo =
+        FindInChain<VkExportMemoryAllocateInfo>(pAllocateInfo->pNext, VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO);
+
+    if (exportInfo == nullptr || exportInfo->handleTypes == 0)
+        return result;
+
+    auto dedicatedInfo = FindInChain<VkMemoryDedicatedAllocateInfo>(
+        pAllocateInfo->pNext, VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO);
+
+    ExternalMemoryInfo memory {};
+    memory.HandleTypes = exportInfo->handleTypes;
+
+    if (dedicatedInfo != nullptr)
+        memory.DedicatedImage = dedicatedInfo->image;
+
+    std::scoped_lock lock(externalMemoryMutex);
+    externalMemories[*pMemory] = memory;
+
+    return result;
+}
+
+void Vulkan_wDx12::hk_vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
+{
+    if (memory != VK_NULL_HANDLE)
+    {
+        std::scoped_lock lock(externalMemoryMutex);
+        externalMemories.erase(memory);
+    }
+
+    o_vkFreeMemory(device, memory, pAllocator);
+}
+
+VkResult Vulkan_wDx12::hk_vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory,
+                                            VkDeviceSize memoryOffset)
+{
+    auto result = o_vkBindImageMemory(device, image, memory, memoryOffset);
+
+    if (result != VK_SUCCESS)
+        return result;
+
+    std::scoped_lock lock(externalMemoryMutex);
+
+    auto imageIt = externalImages.find(image);
+    if (imageIt == externalImages.end())
+        return result;
+
+    auto memoryIt = externalMemories.find(memory);
+    if (memoryIt == externalMemories.end())
+        return result;
+
+    imageIt->second.Memory = memory;
+    imageIt->second.Info.MemoryHandleTypes = memoryIt->second.HandleTypes;
+    imageIt->second.Info.DedicatedMemory = memoryIt->second.DedicatedImage == image && memoryOffset == 0;
+
+    return result;
+}
+
+bool Vulkan_wDx12::GetExternalImageInfo(VkImage image, VkInterop::ImageInfo* info, VkDeviceMemory* memory)
+{
+    std::scoped_lock lock(externalMemoryMutex);
+
+    auto it = externalImages.find(image);
+    if (it == externalImages.end() || it->second.Memory == VK_NULL_HANDLE)
+        return false;
+
+    if (info != nullptr)
+        *info = it->second.Info;
+
+    if (memory != nullptr)
+        *memory = it->second.Memory;
+
+    return true;
+}
+
 void Vulkan_wDx12::hk_vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                            const VkCommandBuffer* pCommandBuffers)
 {
@@ -7309,6 +7469,41 @@ PFN_vkVoidFunction Vulkan_wDx12::GetAddress(const PFN_vkVoidFunction original, c
 
         return (PFN_vkVoidFunction) hk_vkCreateCommandPool;
     }
+    if (procName == std::string("vkCreateImage"))
+    {
+        if (o_vkCreateImage == nullptr)
+            o_vkCreateImage = (PFN_vkCreateImage) original;
+
+        return (PFN_vkVoidFunction) hk_vkCreateImage;
+    }
+    if (procName == std::string("vkDestroyImage"))
+    {
+        if (o_vkDestroyImage == nullptr)
+            o_vkDestroyImage = (PFN_vkDestroyImage) original;
+
+        return (PFN_vkVoidFunction) hk_vkDestroyImage;
+    }
+    if (procName == std::string("vkAllocateMemory"))
+    {
+        if (o_vkAllocateMemory == nullptr)
+            o_vkAllocateMemory = (PFN_vkAllocateMemory) original;
+
+        return (PFN_vkVoidFunction) hk_vkAllocateMemory;
+    }
+    if (procName == std::string("vkFreeMemory"))
+    {
+        if (o_vkFreeMemory == nullptr)
+            o_vkFreeMemory = (PFN_vkFreeMemory) original;
+
+        return (PFN_vkVoidFunction) hk_vkFreeMemory;
+    }
+    if (procName == std::string("vkBindImageMemory"))
+    {
+        if (o_vkBindImageMemory == nullptr)
+            o_vkBindImageMemory = (PFN_vkBindImageMemory) original;
+
+        return (PFN_vkVoidFunction) hk_vkBindImageMemory;
+    }
     if (procName == std::string("vkFreeCommandBuffers"))
     {
         // LOG_DEBUG("vkFreeCommandBuffers");
@@ -9787,6 +9982,11 @@ void Vulkan_wDx12::Hook(HMODULE vulkanModule)
         (PFN_vkAllocateCommandBuffers) GetProcAddress(vulkanModule, "vkAllocateCommandBuffers");
     o_vkDestroyCommandPool = (PFN_vkDestroyCommandPool) GetProcAddress(vulkanModule, "vkDestroyCommandPool");
     o_vkCreateCommandPool = (PFN_vkCreateCommandPool) GetProcAddress(vulkanModule, "vkCreateCommandPool");
+    o_vkCreateImage = (PFN_vkCreateImage) GetProcAddress(vulkanModule, "vkCreateImage");
+    o_vkDestroyImage = (PFN_vkDestroyImage) GetProcAddress(vulkanModule, "vkDestroyImage");
+    o_vkAllocateMemory = (PFN_vkAllocateMemory) GetProcAddress(vulkanModule, "vkAllocateMemory");
+    o_vkFreeMemory = (PFN_vkFreeMemory) GetProcAddress(vulkanModule, "vkFreeMemory");
+    o_vkBindImageMemory = (PFN_vkBindImageMemory) GetProcAddress(vulkanModule, "vkBindImageMemory");
 
 #pragma region vkCmd functions
 
@@ -10258,6 +10458,21 @@ void Vulkan_wDx12::Hook(HMODULE vulkanModule)
         if (o_vkCreateCommandPool)
             DetourAttach(&(PVOID&) o_vkCreateCommandPool, hk_vkCreateCommandPool);
 
+        if (o_vkCreateImage)
+            DetourAttach(&(PVOID&) o_vkCreateImage, hk_vkCreateImage);
+
+        if (o_vkDestroyImage)
+            DetourAttach(&(PVOID&) o_vkDestroyImage, hk_vkDestroyImage);
+
+        if (o_vkAllocateMemory)
+            DetourAttach(&(PVOID&) o_vkAllocateMemory, hk_vkAllocateMemory);
+
+        if (o_vkFreeMemory)
+            DetourAttach(&(PVOID&) o_vkFreeMemory, hk_vkFreeMemory);
+
+        if (o_vkBindImageMemory)
+            DetourAttach(&(PVOID&) o_vkBindImageMemory, hk_vkBindImageMemory);
+
 #pragma region CommandBuffer detours
 
         if (o_vkCmdBindPipeline)
@@ -4,6 +4,8 @@
 
 #include "CommandBuffer_StateTracker.h"
 
+#include <upscalers/VkwDx12_Interop.h>
+
 #include <vulkan/vulkan.hpp>
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
@@ -27,6 +29,16 @@ class Vulkan_wDx12
     static void hk_vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                         const VkAllocationCallbacks* pAllocator);
 
+    // External memory tracking
+    static VkResult hk_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                                     const VkAllocationCallbacks* pAllocator, VkImage* pImage);
+    static void hk_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator);
+    static VkResult hk_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                        const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory);
+    static void hk_vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator);
+    static VkResult hk_vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory,
+                                         VkDeviceSize memoryOffset);
+
     static void hk_vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                         const VkCommandBuffer* pCommandBuffers);
     static PFN_vkVoidFunction GetAddress(const PFN_vkVoidFunction original, const char* pName);
@@ -598,6 +610,10 @@ class Vulkan_wDx12
 
     static void Hook(HMODULE vulkanModule);
     static void Unhook();
+
+    // Returns false if image is not created for external memory or not bound yet
+    static bool GetExternalImageInfo(VkImage image, VkInterop::ImageInfo* info, VkDeviceMemory* memory);
+
     static PFN_vkVoidFunction GetDeviceProcAddr(const PFN_vkVoidFunction original, const char* pName);
     static PFN_vkVoidFunction GetInstanceProcAddr(const PFN_vkVoidFunction original, const char* pName);
     static void EndCmdBuffer(VkCommandBuffer commandBuffer);
@@ -6,6 +6,7 @@
 #include <Config.h>
 
 #include <framegen/IFGFeature_Dx12.h>
+#include <resource_tracking/ResourceDesc_Dx12.h>
 
 inline static int GetFormatGroup(DXGI_FORMAT format)
 {
@@ -258,6 +259,9 @@ void Hudfix_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D
     if (InBeforeState == InAfterState)
         return;
 
+    if (BarrierBatch_Dx12::Transition(InCommandList, InResource, InBeforeState, InAfterState))
+        return;
+
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Transition.pResource = InResource;
@@ -358,7 +362,7 @@ bool Hudfix_Dx12::CheckResource(ResourceInfo* resource)
     }
 
     // Get resource info
-    auto resDesc = resource->buffer->GetDesc();
+    auto resDesc = ResourceDesc_Dx12::Get(resource->buffer);
 
     // dimensions not match
     uint32_t width = s.currentSwapchainDesc.BufferDesc.Width;
@@ -742,6 +746,8 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
                 if (state != D3D12_RESOURCE_STATE_VIDEO_ENCODE_WRITE)
                     ResourceBarrier(cmdList, resource->buffer, resource->state, D3D12_RESOURCE_STATE_COPY_SOURCE);
 
+                // Transition might be waiting in a barrier batch of the list
+                BarrierBatch_Dx12::FlushPending(cmdList);
                 cmdList->CopyResource(_captureBuffer[fIndex], resource->buffer);
 
                 // Using state D3D12_RESOURCE_STATE_VIDEO_ENCODE_WRITE as skip flag
@@ -786,6 +792,9 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
                 srcBox.front = 0;
                 srcBox.back = 1;
 
+                // Transition might be waiting in a barrier batch of the list
+                BarrierBatch_Dx12::FlushPending(cmdList);
+
                 if (scWidth > resource->width || scHeight > resource->height)
                 {
                     srcBox.right = static_cast<UINT>(resource->width);
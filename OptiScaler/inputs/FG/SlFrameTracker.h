@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <thread>
+
+// Set of Streamline buffer types as a bitmask, types above 63 are never contained
+class SlBufferTypeFilter
+{
+    uint64_t _mask = 0;
+
+  public:
+    constexpr SlBufferTypeFilter(std::initializer_list<uint32_t> types)
+    {
+        for (auto type : types)
+        {
+            if (type < 64)
+                _mask |= 1ull << type;
+        }
+    }
+
+    constexpr bool Contains(uint32_t type) const { return type < 64 && ((_mask >> type) & 1ull) != 0; }
+};
+
+// Detects frame boundaries from tags, constants and present markers which can arrive on several threads.
+// Frame id, closed and starting flags are packed in one atomic, a new frame is claimed with a single
+// compare-exchange and only the thread which claimed it calls StartNewFrame of the FG output.
+// Fg buffer index of each frame is kept in a slot picked by frame id modulo SlotCount.
+// Doesn't depend on Streamline or D3D12, starting the frame is passed in by the caller:
+//   uint32_t start() // returns the FG buffer index of the new frame
+template <uint32_t SlotCount> class SlFrameTracker
+{
+    static constexpr uint64_t IdMask = 0xFFFFFFFFull;
+    static constexpr uint64_t Closed = 1ull << 32;   // Frame was presented
+    static constexpr uint64_t Starting = 1ull << 33; // Claimed, buffer index not published yet
+
+    std::atomic<uint64_t> _state = 0;
+    std::atomic<uint32_t> _currentIndex = UINT32_MAX;
+
+    // Frame id in the high, buffer index in the low 32 bits
+    std::atomic<uint64_t> _slots[SlotCount];
+
+  public:
+    SlFrameTracker() { Reset(); }
+
+    void Reset()
+    {
+        _state.store(0, std::memory_order_relaxed);
+        _currentIndex.store(UINT32_MAX, std::memory_order_relaxed);
+
+        for (uint32_t i = 0; i < SlotCount; i++)
+            _slots[i].store(UINT64_MAX, std::memory_order_relaxed);
+    }
+
+    // frameId 0 means the caller doesn't know it, then a frame only starts after the current one is presented.
+    // Returns true if this call started a new frame.
+    template <typename StartFrame> bool CheckForFrame(uint32_t frameId, StartFrame&& start)
+    {
+        auto state = _state.load(std::memory_order_acquire);
+
+        while (true)
+        {
+            // Someone else is starting a frame, wait for its index so lookups don't miss it
+            if ((state & Starting) != 0)
+            {
+                std::this_thread::yield();
+                state = _state.load(std::memory_order_acquire);
+                continue;
+            }
+
+            auto current = static_cast<uint32_t>(state & IdMask);
+            uint32_t newId = 0;
+
+            if (frameId == 0 && (state & Closed) != 0 && current != 0)
+                newId = current + 1;
+            else if (frameId != 0 && frameId > current)
+                newId = frameId;
+            else
+                return false;
+
+            if (_state.compare_exchange_weak(state, newId | Starting, std::memory_order_acq_rel,
+                                             std::memory_order_acquire))
+            {
+                uint32_t index = start();
+
+                _slots[newId % SlotCount].store((uint64_t(newId) << 32) | index, std::memory_order_release);
+                _currentIndex.store(index, std::memory_order_release);
+                _state.fetch_and(~Starting, std::memory_order_acq_rel);
+
+                return true;
+            }
+        }
+    }
+
+    // Present of the frame, closes it if it's the current one
+    void MarkPresent(uint32_t frameId)
+    {
+        auto state = _state.load(std::memory_order_acquire);
+
+        while (true)
+        {
+            auto desired = (state & ~Closed);
+
+            if (frameId == static_cast<uint32_t>(state & IdMask))
+                desired |= Closed;
+
+            if (desired == state ||
+                _state.compare_exchange_weak(state, desired, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return;
+            }
+        }
+    }
+
+    // Buffer index of the frame, -1 when it's not tracked anymore
+    int IndexForFrameId(uint32_t frameId) const
+    {
+        auto slot = _slots[frameId % SlotCount].load(std::memory_order_acquire);
+
+        if (static_cast<uint32_t>(slot >> 32) != frameId)
+            return -1;
+
+        return static_cast<int>(slot & IdMask);
+    }
+
+    uint32_t CurrentFrameId() const { return static_cast<uint32_t>(_state.load(std::memory_order_acquire) & IdMask); }
+    uint32_t CurrentIndex() const { return _currentIndex.load(std::memory_order_acquire); }
+};
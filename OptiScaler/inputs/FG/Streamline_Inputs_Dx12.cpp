@@ -2,53 +2,21 @@
 #include "Streamline_Inputs_Dx12.h"
 #include <Config.h>
 #include <resource_tracking/ResTrack_dx12.h>
-#include <magic_enum.hpp>
 
 void Sl_Inputs_Dx12::CheckForFrame(IFGFeature_Dx12* fg, uint32_t frameId)
 {
-    std::scoped_lock lock(_frameBoundaryMutex);
-
-    if (_isFrameFinished && _lastFrameId == _currentFrameId && frameId == 0 && frameId != _currentFrameId)
-    {
-        LOG_DEBUG("1> CheckForFrame: frameId={}, currentFrameId={}, lastFrameId={}, isFrameFinished={}", frameId,
-                  _currentFrameId, _lastFrameId, _isFrameFinished);
-
-        _isFrameFinished = false;
-
-        fg->StartNewFrame();
-        _currentIndex = fg->GetIndex();
-
-        if (frameId != 0)
-            _currentFrameId = frameId;
-        else
-            _currentFrameId = _lastFrameId + 1;
-
-        _frameIdIndex[_currentIndex] = _currentFrameId;
-    }
-    else if (frameId != 0 && frameId > _currentFrameId)
+    auto started = _frames.CheckForFrame(frameId,
+                                         [fg]()
+                                         {
+                                             fg->StartNewFrame();
+                                             return (uint32_t) fg->GetIndex();
+                                         });
+
+    if (started)
     {
-        LOG_DEBUG("2> CheckForFrame: frameId={}, currentFrameId={}, lastFrameId={}, isFrameFinished={}", frameId,
-                  _currentFrameId, _lastFrameId, _isFrameFinished);
-
-        _isFrameFinished = false;
-        _lastFrameId = frameId - 1;
-
-        fg->StartNewFrame();
-        _currentIndex = fg->GetIndex();
-        _currentFrameId = frameId;
-        _frameIdIndex[_currentIndex] = _currentFrameId;
-    }
-}
-
-int Sl_Inputs_Dx12::IndexForFrameId(uint32_t frameId) const
-{
-    for (int i = 0; i < BUFFER_COUNT; i++)
-    {
-        if (_frameIdIndex[i] == frameId)
-            return i;
+        LOG_DEBUG("CheckForFrame: frameId={}, currentFrameId={}, index={}", frameId, _frames.CurrentFrameId(),
+                  _frames.CurrentIndex());
     }
-
-    return -1;
 }
 
 bool Sl_Inputs_Dx12::setConstants(const sl::Constants& values, uint32_t frameId)
@@ -293,8 +261,8 @@ bool Sl_Inputs_Dx12::reportResource(const sl::ResourceTag& tag, ID3D12GraphicsCo
     if (fgOutput == nullptr || !Config::Instance()->FGEnabled.value_or_default())
         return false;
 
-    LOG_DEBUG("Reporting SL resource type: {} lifecycle: {} frameId: {}", tag.type,
-              magic_enum::enum_name(tag.lifecycle), frameId);
+    LOG_TRACE("Reporting SL resource type: {} lifecycle: {} frameId: {}", tag.type, (uint32_t) tag.lifecycle,
+              frameId);
 
     CheckForFrame(fgOutput, frameId);
 
@@ -308,7 +276,7 @@ bool Sl_Inputs_Dx12::reportResource(const sl::ResourceTag& tag, ID3D12GraphicsCo
         LOG_TRACE("cmdBuffer is null");
 
     auto d3dRes = (ID3D12Resource*) tag.resource->native;
-    auto desc = d3dRes->GetDesc();
+    auto desc = ResourceDesc_Dx12::Get(d3dRes);
 
     Dx12Resource res = {};
     res.resource = d3dRes;
@@ -321,7 +289,7 @@ bool Sl_Inputs_Dx12::reportResource(const sl::ResourceTag& tag, ID3D12GraphicsCo
 
     if (frameId > 0)
     {
-        int index = IndexForFrameId(frameId);
+        int index = _frames.IndexForFrameId(frameId);
 
         if (index >= 0)
         {
@@ -329,8 +297,9 @@ bool Sl_Inputs_Dx12::reportResource(const sl::ResourceTag& tag, ID3D12GraphicsCo
         }
         else
         {
-            LOG_WARN("Frame ID {} not found in tracking, using current index {}", frameId, _currentIndex);
-            res.frameIndex = _currentIndex;
+            auto currentIndex = _frames.CurrentIndex();
+            LOG_WARN("Frame ID {} not found in tracking, using current index {}", frameId, currentIndex);
+            res.frameIndex = currentIndex;
         }
     }
     else
@@ -409,7 +378,7 @@ bool Sl_Inputs_Dx12::reportResource(const sl::ResourceTag& tag, ID3D12GraphicsCo
         // Fallback size logic
         UINT64 width = 0;
         UINT height = 0;
-        fgOutput->GetInterpolationRect(width, height, _currentIndex);
+        fgOutput->GetInterpolationRect(width, height, (int) _frames.CurrentIndex());
 
         if (width == 0)
             fgOutput->SetInterpolationRect(res.width, res.height);
@@ -432,10 +401,8 @@ bool Sl_Inputs_Dx12::dispatchFG()
 
 void Sl_Inputs_Dx12::markPresent(uint64_t frameId)
 {
-    std::scoped_lock lock(_frameBoundaryMutex);
     LOG_TRACE("frameId: {}", frameId);
-    _isFrameFinished = true;
-    _lastFrameId = static_cast<uint32_t>(frameId);
+    _frames.MarkPresent(static_cast<uint32_t>(frameId));
 
     if (State::Instance().currentFG != nullptr)
         State::Instance().currentFG->SetFrameCount(frameId);
@@ -2,6 +2,16 @@
 #include "SysUtils.h"
 #include <sl.h>
 #include <framegen/IFGFeature_Dx12.h>
+#include "SlFrameTracker.h"
+
+// Tag types FG uses, checked before anything else in tag hooks
+inline constexpr SlBufferTypeFilter SlFGBufferTypes { sl::kBufferTypeHUDLessColor,
+                                                      sl::kBufferTypeDepth,
+                                                      sl::kBufferTypeHiResDepth,
+                                                      sl::kBufferTypeLinearDepth,
+                                                      sl::kBufferTypeMotionVectors,
+                                                      sl::kBufferTypeUIColorAndAlpha,
+                                                      sl::kBufferTypeBidirectionalDistortionField };
 
 class Sl_Inputs_Dx12
 {
@@ -9,19 +19,12 @@ class Sl_Inputs_Dx12
     bool infiniteDepth = false;
     sl::EngineType engineType = sl::EngineType::eCount;
 
-    std::mutex _frameBoundaryMutex;
-    bool _isFrameFinished = true;
-
-    uint32_t _currentFrameId = 0;
-    uint32_t _currentIndex = -1;
-    uint32_t _lastFrameId = UINT32_MAX;
-    uint32_t _frameIdIndex[BUFFER_COUNT] = { UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX };
+    SlFrameTracker<BUFFER_COUNT> _frames;
 
     uint64_t mvsWidth = 0;
     uint32_t mvsHeight = 0;
 
     void CheckForFrame(IFGFeature_Dx12* fg, uint32_t frameId);
-    int IndexForFrameId(uint32_t frameId) const;
 
   public:
     bool setConstants(const sl::Constants& constants, uint32_t frameId);
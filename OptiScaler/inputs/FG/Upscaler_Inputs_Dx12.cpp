@@ -26,7 +26,7 @@ void UpscalerInputsDx12::Reset()
         Hudfix_Dx12::ResetCounters();
 }
 
-void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSDK_NGX_Parameter* InParameters,
+void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, const UpscaleFrameInputs& InInputs,
                                       IFeature_Dx12* feature)
 {
     Hudfix_Dx12::SetSkipStatus(true);
@@ -36,20 +36,12 @@ void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSD
     float cameraFar = 0.0f;
     float cameraVFov = 0.0f;
     float meterFactor = 0.0f;
-    float mvScaleX = 0.0f;
-    float mvScaleY = 0.0f;
-    float jitterX = 0.0f;
-    float jitterY = 0.0f;
-
-    float tempCameraNear = 0.0f;
-    float tempCameraFar = 0.0f;
 
     auto& state = State::Instance();
     auto& cfg = *Config::Instance();
-    const auto& ngxParams = *InParameters;
 
-    ngxParams.Get(OptiKeys::FSR_NearPlane, &tempCameraNear);
-    ngxParams.Get(OptiKeys::FSR_FarPlane, &tempCameraFar);
+    float tempCameraNear = InInputs.CameraNear.value_or(0.0f);
+    float tempCameraFar = InInputs.CameraFar.value_or(0.0f);
 
     if (!cfg.FsrUseFsrInputValues.value_or_default() || (tempCameraNear == 0.0f && tempCameraFar == 0.0f))
     {
@@ -70,8 +62,11 @@ void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSD
         cameraFar = tempCameraFar;
     }
 
-    if (!cfg.FsrUseFsrInputValues.value_or_default() ||
-        ngxParams.Get(OptiKeys::FSR_CameraFovVertical, &cameraVFov) != NVSDK_NGX_Result_Success)
+    if (cfg.FsrUseFsrInputValues.value_or_default() && InInputs.CameraFovVertical.has_value())
+    {
+        cameraVFov = InInputs.CameraFovVertical.value();
+    }
+    else
     {
         if (cfg.FsrVerticalFov.has_value())
             cameraVFov = GetRadiansFromDeg(cfg.FsrVerticalFov.value());
@@ -86,7 +81,7 @@ void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSD
     }
 
     if (!cfg.FsrUseFsrInputValues.value_or_default())
-        ngxParams.Get(OptiKeys::FSR_ViewSpaceToMetersFactor, &meterFactor);
+        meterFactor = InInputs.ViewSpaceToMeters.value_or(0.0f);
 
     State::Instance().lastFsrCameraFar = cameraFar;
     State::Instance().lastFsrCameraNear = cameraNear;
@@ -117,22 +112,14 @@ void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSD
 
     fg->EvaluateState(_device, fgConstants);
 
-    int reset = 0;
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
-
-    InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &mvScaleX);
-    InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &mvScaleY);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &jitterX);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &jitterY);
-
     fg->StartNewFrame();
 
     auto aspectRatio = (float) feature->DisplayWidth() / (float) feature->DisplayHeight();
     fg->SetCameraValues(cameraNear, cameraFar, cameraVFov, aspectRatio, meterFactor);
     fg->SetFrameTimeDelta(State::Instance().lastFGFrameTime);
-    fg->SetMVScale(mvScaleX, mvScaleY);
-    fg->SetJitter(jitterX, jitterY);
-    fg->SetReset(reset);
+    fg->SetMVScale(InInputs.MVScaleX, InInputs.MVScaleY);
+    fg->SetJitter(InInputs.JitterX, InInputs.JitterY);
+    fg->SetReset(InInputs.Reset);
     fg->SetInterpolationRect(feature->DisplayWidth(), feature->DisplayHeight());
 
     Hudfix_Dx12::UpscaleStart();
@@ -158,9 +145,7 @@ void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSD
 
         LOG_DEBUG("(FG) copy buffers for fgUpscaledImage[{}], frame: {}", frameIndex, fg->FrameCount());
 
-        ID3D12Resource* paramVelocity = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+        ID3D12Resource* paramVelocity = InInputs.MotionVectors;
 
         if (paramVelocity != nullptr)
         {
@@ -186,9 +171,7 @@ void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSD
             fg->SetResource(&setResource);
         }
 
-        ID3D12Resource* paramDepth = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth);
+        ID3D12Resource* paramDepth = InInputs.Depth;
 
         if (paramDepth != nullptr)
         {
@@ -243,7 +226,7 @@ void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSD
     }
 }
 
-void UpscalerInputsDx12::UpscaleEnd(ID3D12GraphicsCommandList* InCmdList, NVSDK_NGX_Parameter* InParameters,
+void UpscalerInputsDx12::UpscaleEnd(ID3D12GraphicsCommandList* InCmdList, const UpscaleFrameInputs& InInputs,
                                     IFeature_Dx12* feature)
 {
     Hudfix_Dx12::SetSkipStatus(false);
@@ -262,9 +245,7 @@ void UpscalerInputsDx12::UpscaleEnd(ID3D12GraphicsCommandList* InCmdList, NVSDK_
             // For signal after mv & depth copies
             Hudfix_Dx12::UpscaleEnd(feature->FrameCount(), State::Instance().lastFGFrameTime);
 
-            ID3D12Resource* output = nullptr;
-            if (InParameters->Get(NVSDK_NGX_Parameter_Output, &output) != NVSDK_NGX_Result_Success)
-                InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &output);
+            ID3D12Resource* output = InInputs.Output;
 
             ResourceInfo info {};
             auto desc = output->GetDesc();
@@ -11,8 +11,8 @@ class UpscalerInputsDx12
   public:
     static void Init(ID3D12Device* device);
     static void Reset();
-    static void UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSDK_NGX_Parameter* InParameters,
+    static void UpscaleStart(ID3D12GraphicsCommandList* InCmdList, const UpscaleFrameInputs& InInputs,
                              IFeature_Dx12* feature);
-    static void UpscaleEnd(ID3D12GraphicsCommandList* InCmdList, NVSDK_NGX_Parameter* InParameters,
+    static void UpscaleEnd(ID3D12GraphicsCommandList* InCmdList, const UpscaleFrameInputs& InInputs,
                            IFeature_Dx12* feature);
 };
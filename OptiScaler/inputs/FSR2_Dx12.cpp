@@ -5,6 +5,7 @@
 #include "Config.h"
 #include "resource.h"
 #include "NVNGX_Parameter.h"
+#include "upscalers/UpscaleFrameInputs.h"
 
 #include <proxies/KernelBase_Proxy.h>
 
@@ -622,36 +623,34 @@ static Fsr212::FfxErrorCode ffxFsr2ContextDispatch_Dx12(Fsr212::FfxFsr2Context*
     NVSDK_NGX_Parameter* params = _nvParams[context];
     NVSDK_NGX_Handle* handle = _contexts[context];
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, dispatchDescription->jitterOffset.x);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, dispatchDescription->jitterOffset.y);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_X, dispatchDescription->motionVectorScale.x);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, dispatchDescription->motionVectorScale.y);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, 1.0);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, dispatchDescription->preExposure);
-    params->Set(NVSDK_NGX_Parameter_Reset, dispatchDescription->reset ? 1 : 0);
-    params->Set(NVSDK_NGX_Parameter_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_Depth, dispatchDescription->depth.resource);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, dispatchDescription->exposure.resource);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Color, dispatchDescription->color.resource);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, dispatchDescription->motionVectors.resource);
-    params->Set(NVSDK_NGX_Parameter_Output, dispatchDescription->output.resource);
-    params->Set("FSR.cameraNear", dispatchDescription->cameraNear);
-    params->Set("FSR.cameraFar", dispatchDescription->cameraFar);
-    params->Set("FSR.cameraFovAngleVertical", dispatchDescription->cameraFovAngleVertical);
-    params->Set("FSR.frameTimeDelta", dispatchDescription->frameTimeDelta);
-    params->Set("FSR.transparencyAndComposition", dispatchDescription->transparencyAndComposition.resource);
-    params->Set("FSR.reactive", dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Sharpness, dispatchDescription->sharpness);
+    UpscaleFrameInputs inputs {};
+    inputs.JitterX = dispatchDescription->jitterOffset.x;
+    inputs.JitterY = dispatchDescription->jitterOffset.y;
+    inputs.SetMVScale(dispatchDescription->motionVectorScale.x, dispatchDescription->motionVectorScale.y);
+    inputs.PreExposure = dispatchDescription->preExposure;
+    inputs.Reset = dispatchDescription->reset;
+    inputs.SetRenderSize(dispatchDescription->renderSize.width, dispatchDescription->renderSize.height);
+    inputs.Depth = (ID3D12Resource*) dispatchDescription->depth.resource;
+    inputs.Exposure = (ID3D12Resource*) dispatchDescription->exposure.resource;
+    inputs.BiasMask = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Color = (ID3D12Resource*) dispatchDescription->color.resource;
+    inputs.MotionVectors = (ID3D12Resource*) dispatchDescription->motionVectors.resource;
+    inputs.Output = (ID3D12Resource*) dispatchDescription->output.resource;
+    inputs.CameraNear = dispatchDescription->cameraNear;
+    inputs.CameraFar = dispatchDescription->cameraFar;
+    inputs.CameraFovVertical = dispatchDescription->cameraFovAngleVertical;
+    inputs.FrameTimeDelta = dispatchDescription->frameTimeDelta;
+    inputs.TransparencyAndComposition = (ID3D12Resource*) dispatchDescription->transparencyAndComposition.resource;
+    inputs.Reactive = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Sharpness = dispatchDescription->sharpness;
 
     LOG_DEBUG("handle: {:X}, internalResolution: {}x{}", handle->Id, dispatchDescription->renderSize.width,
               dispatchDescription->renderSize.height);
 
     State::Instance().setInputApiName = "FSR2.X";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     auto evalResult = NVSDK_NGX_D3D12_EvaluateFeature((ID3D12GraphicsCommandList*) dispatchDescription->commandList,
                                                       handle, params, nullptr);
 
@@ -686,36 +685,34 @@ ffxFsr2ContextDispatch_Pattern_Dx12(Fsr212::FfxFsr2Context* context,
     NVSDK_NGX_Parameter* params = _nvParams[context];
     NVSDK_NGX_Handle* handle = _contexts[context];
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, dispatchDescription->jitterOffset.x);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, dispatchDescription->jitterOffset.y);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_X, dispatchDescription->motionVectorScale.x);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, dispatchDescription->motionVectorScale.y);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, 1.0);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, dispatchDescription->preExposure);
-    params->Set(NVSDK_NGX_Parameter_Reset, dispatchDescription->reset ? 1 : 0);
-    params->Set(NVSDK_NGX_Parameter_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_Depth, dispatchDescription->depth.resource);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, dispatchDescription->exposure.resource);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Color, dispatchDescription->color.resource);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, dispatchDescription->motionVectors.resource);
-    params->Set(NVSDK_NGX_Parameter_Output, dispatchDescription->output.resource);
-    params->Set("FSR.cameraNear", dispatchDescription->cameraNear);
-    params->Set("FSR.cameraFar", dispatchDescription->cameraFar);
-    params->Set("FSR.cameraFovAngleVertical", dispatchDescription->cameraFovAngleVertical);
-    params->Set("FSR.frameTimeDelta", dispatchDescription->frameTimeDelta);
-    params->Set("FSR.transparencyAndComposition", dispatchDescription->transparencyAndComposition.resource);
-    params->Set("FSR.reactive", dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Sharpness, dispatchDescription->sharpness);
+    UpscaleFrameInputs inputs {};
+    inputs.JitterX = dispatchDescription->jitterOffset.x;
+    inputs.JitterY = dispatchDescription->jitterOffset.y;
+    inputs.SetMVScale(dispatchDescription->motionVectorScale.x, dispatchDescription->motionVectorScale.y);
+    inputs.PreExposure = dispatchDescription->preExposure;
+    inputs.Reset = dispatchDescription->reset;
+    inputs.SetRenderSize(dispatchDescription->renderSize.width, dispatchDescription->renderSize.height);
+    inputs.Depth = (ID3D12Resource*) dispatchDescription->depth.resource;
+    inputs.Exposure = (ID3D12Resource*) dispatchDescription->exposure.resource;
+    inputs.BiasMask = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Color = (ID3D12Resource*) dispatchDescription->color.resource;
+    inputs.MotionVectors = (ID3D12Resource*) dispatchDescription->motionVectors.resource;
+    inputs.Output = (ID3D12Resource*) dispatchDescription->output.resource;
+    inputs.CameraNear = dispatchDescription->cameraNear;
+    inputs.CameraFar = dispatchDescription->cameraFar;
+    inputs.CameraFovVertical = dispatchDescription->cameraFovAngleVertical;
+    inputs.FrameTimeDelta = dispatchDescription->frameTimeDelta;
+    inputs.TransparencyAndComposition = (ID3D12Resource*) dispatchDescription->transparencyAndComposition.resource;
+    inputs.Reactive = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Sharpness = dispatchDescription->sharpness;
 
     LOG_DEBUG("handle: {:X}, internalResolution: {}x{}", handle->Id, dispatchDescription->renderSize.width,
               dispatchDescription->renderSize.height);
 
     State::Instance().setInputApiName = "FSR2.X";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     auto evalResult = NVSDK_NGX_D3D12_EvaluateFeature((ID3D12GraphicsCommandList*) dispatchDescription->commandList,
                                                       handle, params, nullptr);
 
@@ -753,36 +750,34 @@ static Fsr212::FfxErrorCode ffxFsr20ContextDispatch_Dx12(Fsr212::FfxFsr2Context*
     NVSDK_NGX_Parameter* params = _nvParams[context];
     NVSDK_NGX_Handle* handle = _contexts[context];
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, dispatchDescription->jitterOffset.x);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, dispatchDescription->jitterOffset.y);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_X, dispatchDescription->motionVectorScale.x);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, dispatchDescription->motionVectorScale.y);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, 1.0);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, dispatchDescription->preExposure);
-    params->Set(NVSDK_NGX_Parameter_Reset, dispatchDescription->reset ? 1 : 0);
-    params->Set(NVSDK_NGX_Parameter_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_Depth, dispatchDescription->depth.resource);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, dispatchDescription->exposure.resource);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Color, dispatchDescription->color.resource);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, dispatchDescription->motionVectors.resource);
-    params->Set(NVSDK_NGX_Parameter_Output, dispatchDescription->output.resource);
-    params->Set("FSR.cameraNear", dispatchDescription->cameraNear);
-    params->Set("FSR.cameraFar", dispatchDescription->cameraFar);
-    params->Set("FSR.cameraFovAngleVertical", dispatchDescription->cameraFovAngleVertical);
-    params->Set("FSR.frameTimeDelta", dispatchDescription->frameTimeDelta);
-    params->Set("FSR.transparencyAndComposition", dispatchDescription->transparencyAndComposition.resource);
-    params->Set("FSR.reactive", dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Sharpness, dispatchDescription->sharpness);
+    UpscaleFrameInputs inputs {};
+    inputs.JitterX = dispatchDescription->jitterOffset.x;
+    inputs.JitterY = dispatchDescription->jitterOffset.y;
+    inputs.SetMVScale(dispatchDescription->motionVectorScale.x, dispatchDescription->motionVectorScale.y);
+    inputs.PreExposure = dispatchDescription->preExposure;
+    inputs.Reset = dispatchDescription->reset;
+    inputs.SetRenderSize(dispatchDescription->renderSize.width, dispatchDescription->renderSize.height);
+    inputs.Depth = (ID3D12Resource*) dispatchDescription->depth.resource;
+    inputs.Exposure = (ID3D12Resource*) dispatchDescription->exposure.resource;
+    inputs.BiasMask = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Color = (ID3D12Resource*) dispatchDescription->color.resource;
+    inputs.MotionVectors = (ID3D12Resource*) dispatchDescription->motionVectors.resource;
+    inputs.Output = (ID3D12Resource*) dispatchDescription->output.resource;
+    inputs.CameraNear = dispatchDescription->cameraNear;
+    inputs.CameraFar = dispatchDescription->cameraFar;
+    inputs.CameraFovVertical = dispatchDescription->cameraFovAngleVertical;
+    inputs.FrameTimeDelta = dispatchDescription->frameTimeDelta;
+    inputs.TransparencyAndComposition = (ID3D12Resource*) dispatchDescription->transparencyAndComposition.resource;
+    inputs.Reactive = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Sharpness = dispatchDescription->sharpness;
 
     LOG_DEBUG("handle: {:X}, internalResolution: {}x{}", handle->Id, dispatchDescription->renderSize.width,
               dispatchDescription->renderSize.height);
 
     State::Instance().setInputApiName = "FSR2.0";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     auto evalResult = NVSDK_NGX_D3D12_EvaluateFeature((ID3D12GraphicsCommandList*) dispatchDescription->commandList,
                                                       handle, params, nullptr);
 
@@ -821,36 +816,34 @@ static Fsr212::FfxErrorCode ffxFsr20ContextDispatch_Pattern_Dx12(Fsr212::FfxFsr2
     NVSDK_NGX_Parameter* params = _nvParams[context];
     NVSDK_NGX_Handle* handle = _contexts[context];
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, dispatchDescription->jitterOffset.x);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, dispatchDescription->jitterOffset.y);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_X, dispatchDescription->motionVectorScale.x);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, dispatchDescription->motionVectorScale.y);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, 1.0);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, dispatchDescription->preExposure);
-    params->Set(NVSDK_NGX_Parameter_Reset, dispatchDescription->reset ? 1 : 0);
-    params->Set(NVSDK_NGX_Parameter_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_Depth, dispatchDescription->depth.resource);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, dispatchDescription->exposure.resource);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Color, dispatchDescription->color.resource);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, dispatchDescription->motionVectors.resource);
-    params->Set(NVSDK_NGX_Parameter_Output, dispatchDescription->output.resource);
-    params->Set("FSR.cameraNear", dispatchDescription->cameraNear);
-    params->Set("FSR.cameraFar", dispatchDescription->cameraFar);
-    params->Set("FSR.cameraFovAngleVertical", dispatchDescription->cameraFovAngleVertical);
-    params->Set("FSR.frameTimeDelta", dispatchDescription->frameTimeDelta);
-    params->Set("FSR.transparencyAndComposition", dispatchDescription->transparencyAndComposition.resource);
-    params->Set("FSR.reactive", dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Sharpness, dispatchDescription->sharpness);
+    UpscaleFrameInputs inputs {};
+    inputs.JitterX = dispatchDescription->jitterOffset.x;
+    inputs.JitterY = dispatchDescription->jitterOffset.y;
+    inputs.SetMVScale(dispatchDescription->motionVectorScale.x, dispatchDescription->motionVectorScale.y);
+    inputs.PreExposure = dispatchDescription->preExposure;
+    inputs.Reset = dispatchDescription->reset;
+    inputs.SetRenderSize(dispatchDescription->renderSize.width, dispatchDescription->renderSize.height);
+    inputs.Depth = (ID3D12Resource*) dispatchDescription->depth.resource;
+    inputs.Exposure = (ID3D12Resource*) dispatchDescription->exposure.resource;
+    inputs.BiasMask = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Color = (ID3D12Resource*) dispatchDescription->color.resource;
+    inputs.MotionVectors = (ID3D12Resource*) dispatchDescription->motionVectors.resource;
+    inputs.Output = (ID3D12Resource*) dispatchDescription->output.resource;
+    inputs.CameraNear = dispatchDescription->cameraNear;
+    inputs.CameraFar = dispatchDescription->cameraFar;
+    inputs.CameraFovVertical = dispatchDescription->cameraFovAngleVertical;
+    inputs.FrameTimeDelta = dispatchDescription->frameTimeDelta;
+    inputs.TransparencyAndComposition = (ID3D12Resource*) dispatchDescription->transparencyAndComposition.resource;
+    inputs.Reactive = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Sharpness = dispatchDescription->sharpness;
 
     LOG_DEBUG("handle: {:X}, internalResolution: {}x{}", handle->Id, dispatchDescription->renderSize.width,
               dispatchDescription->renderSize.height);
 
     State::Instance().setInputApiName = "FSR2.0";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     auto evalResult = NVSDK_NGX_D3D12_EvaluateFeature((ID3D12GraphicsCommandList*) dispatchDescription->commandList,
                                                       handle, params, nullptr);
 
@@ -885,36 +878,34 @@ static Fsr212::FfxErrorCode ffxFsr2TinyContextDispatch_Dx12(Fsr212::FfxFsr2Conte
     NVSDK_NGX_Parameter* params = _nvParams[context];
     NVSDK_NGX_Handle* handle = _contexts[context];
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, dispatchDescription->jitterOffset.x);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, dispatchDescription->jitterOffset.y);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_X, dispatchDescription->motionVectorScale.x);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, dispatchDescription->motionVectorScale.y);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, 1.0);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, dispatchDescription->preExposure);
-    params->Set(NVSDK_NGX_Parameter_Reset, dispatchDescription->reset ? 1 : 0);
-    params->Set(NVSDK_NGX_Parameter_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, dispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, dispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_Depth, dispatchDescription->depth.resource);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, dispatchDescription->exposure.resource);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Color, dispatchDescription->color.resource);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, dispatchDescription->motionVectors.resource);
-    params->Set(NVSDK_NGX_Parameter_Output, dispatchDescription->output.resource);
-    params->Set("FSR.cameraNear", dispatchDescription->cameraNear);
-    params->Set("FSR.cameraFar", dispatchDescription->cameraFar);
-    params->Set("FSR.cameraFovAngleVertical", dispatchDescription->cameraFovAngleVertical);
-    params->Set("FSR.frameTimeDelta", dispatchDescription->frameTimeDelta);
-    params->Set("FSR.transparencyAndComposition", dispatchDescription->transparencyAndComposition.resource);
-    params->Set("FSR.reactive", dispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Sharpness, dispatchDescription->sharpness);
+    UpscaleFrameInputs inputs {};
+    inputs.JitterX = dispatchDescription->jitterOffset.x;
+    inputs.JitterY = dispatchDescription->jitterOffset.y;
+    inputs.SetMVScale(dispatchDescription->motionVectorScale.x, dispatchDescription->motionVectorScale.y);
+    inputs.PreExposure = dispatchDescription->preExposure;
+    inputs.Reset = dispatchDescription->reset;
+    inputs.SetRenderSize(dispatchDescription->renderSize.width, dispatchDescription->renderSize.height);
+    inputs.Depth = (ID3D12Resource*) dispatchDescription->depth.resource;
+    inputs.Exposure = (ID3D12Resource*) dispatchDescription->exposure.resource;
+    inputs.BiasMask = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Color = (ID3D12Resource*) dispatchDescription->color.resource;
+    inputs.MotionVectors = (ID3D12Resource*) dispatchDescription->motionVectors.resource;
+    inputs.Output = (ID3D12Resource*) dispatchDescription->output.resource;
+    inputs.CameraNear = dispatchDescription->cameraNear;
+    inputs.CameraFar = dispatchDescription->cameraFar;
+    inputs.CameraFovVertical = dispatchDescription->cameraFovAngleVertical;
+    inputs.FrameTimeDelta = dispatchDescription->frameTimeDelta;
+    inputs.TransparencyAndComposition = (ID3D12Resource*) dispatchDescription->transparencyAndComposition.resource;
+    inputs.Reactive = (ID3D12Resource*) dispatchDescription->reactive.resource;
+    inputs.Sharpness = dispatchDescription->sharpness;
 
     LOG_DEBUG("handle: {:X}, internalResolution: {}x{}", handle->Id, dispatchDescription->renderSize.width,
               dispatchDescription->renderSize.height);
 
     State::Instance().setInputApiName = "FSR2.TT";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     auto evalResult = NVSDK_NGX_D3D12_EvaluateFeature((ID3D12GraphicsCommandList*) dispatchDescription->commandList,
                                                       handle, params, nullptr);
 
@@ -6,6 +6,7 @@
 
 #include "resource.h"
 #include "NVNGX_Parameter.h"
+#include "upscalers/UpscaleFrameInputs.h"
 
 #include <proxies/KernelBase_Proxy.h>
 
@@ -352,31 +353,27 @@ static Fsr3::FfxErrorCode ffxFsr3ContextDispatch_Dx12(Fsr3::FfxFsr3UpscalerConte
     NVSDK_NGX_Parameter* params = _nvParams[pContext];
     NVSDK_NGX_Handle* handle = _contexts[pContext];
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, pDispatchDescription->jitterOffset.x);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, pDispatchDescription->jitterOffset.y);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_X, pDispatchDescription->motionVectorScale.x);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, pDispatchDescription->motionVectorScale.y);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, 1.0);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, pDispatchDescription->preExposure);
-    params->Set(NVSDK_NGX_Parameter_Reset, pDispatchDescription->reset ? 1 : 0);
-    params->Set(NVSDK_NGX_Parameter_Width, pDispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_Height, pDispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, pDispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, pDispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_Depth, pDispatchDescription->depth.resource);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, pDispatchDescription->exposure.resource);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, pDispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Color, pDispatchDescription->color.resource);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, pDispatchDescription->motionVectors.resource);
-    params->Set(NVSDK_NGX_Parameter_Output, pDispatchDescription->output.resource);
-    params->Set("FSR.cameraNear", pDispatchDescription->cameraNear);
-    params->Set("FSR.cameraFar", pDispatchDescription->cameraFar);
-    params->Set("FSR.cameraFovAngleVertical", pDispatchDescription->cameraFovAngleVertical);
-    params->Set("FSR.frameTimeDelta", pDispatchDescription->frameTimeDelta);
-    params->Set("FSR.transparencyAndComposition", pDispatchDescription->transparencyAndComposition.resource);
-    params->Set("FSR.reactive", pDispatchDescription->reactive.resource);
-    params->Set("FSR.viewSpaceToMetersFactor", pDispatchDescription->viewSpaceToMetersFactor);
-    params->Set(NVSDK_NGX_Parameter_Sharpness, pDispatchDescription->sharpness);
+    UpscaleFrameInputs inputs {};
+    inputs.JitterX = pDispatchDescription->jitterOffset.x;
+    inputs.JitterY = pDispatchDescription->jitterOffset.y;
+    inputs.SetMVScale(pDispatchDescription->motionVectorScale.x, pDispatchDescription->motionVectorScale.y);
+    inputs.PreExposure = pDispatchDescription->preExposure;
+    inputs.Reset = pDispatchDescription->reset;
+    inputs.SetRenderSize(pDispatchDescription->renderSize.width, pDispatchDescription->renderSize.height);
+    inputs.Depth = (ID3D12Resource*) pDispatchDescription->depth.resource;
+    inputs.Exposure = (ID3D12Resource*) pDispatchDescription->exposure.resource;
+    inputs.BiasMask = (ID3D12Resource*) pDispatchDescription->reactive.resource;
+    inputs.Color = (ID3D12Resource*) pDispatchDescription->color.resource;
+    inputs.MotionVectors = (ID3D12Resource*) pDispatchDescription->motionVectors.resource;
+    inputs.Output = (ID3D12Resource*) pDispatchDescription->output.resource;
+    inputs.CameraNear = pDispatchDescription->cameraNear;
+    inputs.CameraFar = pDispatchDescription->cameraFar;
+    inputs.CameraFovVertical = pDispatchDescription->cameraFovAngleVertical;
+    inputs.FrameTimeDelta = pDispatchDescription->frameTimeDelta;
+    inputs.TransparencyAndComposition = (ID3D12Resource*) pDispatchDescription->transparencyAndComposition.resource;
+    inputs.Reactive = (ID3D12Resource*) pDispatchDescription->reactive.resource;
+    inputs.ViewSpaceToMeters = pDispatchDescription->viewSpaceToMetersFactor;
+    inputs.Sharpness = pDispatchDescription->sharpness;
 
     if (pDispatchDescription->color.resource != nullptr && pDispatchDescription->color.state > 0)
         Config::Instance()->ColorResourceBarrier.set_volatile_value(GetD3D12State(pDispatchDescription->color.state));
@@ -403,6 +400,8 @@ static Fsr3::FfxErrorCode ffxFsr3ContextDispatch_Dx12(Fsr3::FfxFsr3UpscalerConte
 
     State::Instance().setInputApiName = "FSR3-DX12";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     auto evalResult = NVSDK_NGX_D3D12_EvaluateFeature((ID3D12GraphicsCommandList*) pDispatchDescription->commandList,
                                                       handle, params, nullptr);
 
@@ -574,31 +573,27 @@ ffxFsr3ContextDispatch_Pattern_Dx12(Fsr3::FfxFsr3UpscalerContext* pContext,
     NVSDK_NGX_Parameter* params = _nvParams[pContext];
     NVSDK_NGX_Handle* handle = _contexts[pContext];
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, pDispatchDescription->jitterOffset.x);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, pDispatchDescription->jitterOffset.y);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_X, pDispatchDescription->motionVectorScale.x);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, pDispatchDescription->motionVectorScale.y);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, 1.0);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, pDispatchDescription->preExposure);
-    params->Set(NVSDK_NGX_Parameter_Reset, pDispatchDescription->reset ? 1 : 0);
-    params->Set(NVSDK_NGX_Parameter_Width, pDispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_Height, pDispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, pDispatchDescription->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, pDispatchDescription->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_Depth, pDispatchDescription->depth.resource);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, pDispatchDescription->exposure.resource);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, pDispatchDescription->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Color, pDispatchDescription->color.resource);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, pDispatchDescription->motionVectors.resource);
-    params->Set(NVSDK_NGX_Parameter_Output, pDispatchDescription->output.resource);
-    params->Set("FSR.cameraNear", pDispatchDescription->cameraNear);
-    params->Set("FSR.cameraFar", pDispatchDescription->cameraFar);
-    params->Set("FSR.cameraFovAngleVertical", pDispatchDescription->cameraFovAngleVertical);
-    params->Set("FSR.frameTimeDelta", pDispatchDescription->frameTimeDelta);
-    params->Set("FSR.transparencyAndComposition", pDispatchDescription->transparencyAndComposition.resource);
-    params->Set("FSR.reactive", pDispatchDescription->reactive.resource);
-    params->Set("FSR.viewSpaceToMetersFactor", pDispatchDescription->viewSpaceToMetersFactor);
-    params->Set(NVSDK_NGX_Parameter_Sharpness, pDispatchDescription->sharpness);
+    UpscaleFrameInputs inputs {};
+    inputs.JitterX = pDispatchDescription->jitterOffset.x;
+    inputs.JitterY = pDispatchDescription->jitterOffset.y;
+    inputs.SetMVScale(pDispatchDescription->motionVectorScale.x, pDispatchDescription->motionVectorScale.y);
+    inputs.PreExposure = pDispatchDescription->preExposure;
+    inputs.Reset = pDispatchDescription->reset;
+    inputs.SetRenderSize(pDispatchDescription->renderSize.width, pDispatchDescription->renderSize.height);
+    inputs.Depth = (ID3D12Resource*) pDispatchDescription->depth.resource;
+    inputs.Exposure = (ID3D12Resource*) pDispatchDescription->exposure.resource;
+    inputs.BiasMask = (ID3D12Resource*) pDispatchDescription->reactive.resource;
+    inputs.Color = (ID3D12Resource*) pDispatchDescription->color.resource;
+    inputs.MotionVectors = (ID3D12Resource*) pDispatchDescription->motionVectors.resource;
+    inputs.Output = (ID3D12Resource*) pDispatchDescription->output.resource;
+    inputs.CameraNear = pDispatchDescription->cameraNear;
+    inputs.CameraFar = pDispatchDescription->cameraFar;
+    inputs.CameraFovVertical = pDispatchDescription->cameraFovAngleVertical;
+    inputs.FrameTimeDelta = pDispatchDescription->frameTimeDelta;
+    inputs.TransparencyAndComposition = (ID3D12Resource*) pDispatchDescription->transparencyAndComposition.resource;
+    inputs.Reactive = (ID3D12Resource*) pDispatchDescription->reactive.resource;
+    inputs.ViewSpaceToMeters = pDispatchDescription->viewSpaceToMetersFactor;
+    inputs.Sharpness = pDispatchDescription->sharpness;
 
     if (pDispatchDescription->color.resource != nullptr && pDispatchDescription->color.state > 0)
         Config::Instance()->ColorResourceBarrier.set_volatile_value(GetD3D12State(pDispatchDescription->color.state));
@@ -625,6 +620,8 @@ ffxFsr3ContextDispatch_Pattern_Dx12(Fsr3::FfxFsr3UpscalerContext* pContext,
 
     State::Instance().setInputApiName = "FSR3-DX12";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     auto evalResult = NVSDK_NGX_D3D12_EvaluateFeature((ID3D12GraphicsCommandList*) pDispatchDescription->commandList,
                                                       handle, params, nullptr);
 
@@ -5,6 +5,7 @@
 
 #include "resource.h"
 #include "NVNGX_Parameter.h"
+#include "upscalers/UpscaleFrameInputs.h"
 
 #include <proxies/KernelBase_Proxy.h>
 
@@ -383,39 +384,37 @@ static ffxReturnCode_t ffxDispatch_Dx12(ffxContext* context, ffxDispatchDescHead
     NVSDK_NGX_Parameter* params = _nvParams[*context];
     NVSDK_NGX_Handle* handle = _contexts[*context];
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, dispatchDesc->jitterOffset.x);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, dispatchDesc->jitterOffset.y);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_X, dispatchDesc->motionVectorScale.x);
-    params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, dispatchDesc->motionVectorScale.y);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, 1.0);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, dispatchDesc->preExposure);
-    params->Set(NVSDK_NGX_Parameter_Reset, dispatchDesc->reset ? 1 : 0);
-    params->Set(NVSDK_NGX_Parameter_Width, dispatchDesc->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_Height, dispatchDesc->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, dispatchDesc->renderSize.width);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, dispatchDesc->renderSize.height);
-    params->Set(NVSDK_NGX_Parameter_Depth, dispatchDesc->depth.resource);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, dispatchDesc->exposure.resource);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, dispatchDesc->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Color, dispatchDesc->color.resource);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, dispatchDesc->motionVectors.resource);
-    params->Set(NVSDK_NGX_Parameter_Output, dispatchDesc->output.resource);
-    params->Set("FSR.cameraNear", dispatchDesc->cameraNear);
-    params->Set("FSR.cameraFar", dispatchDesc->cameraFar);
-    params->Set("FSR.cameraFovAngleVertical", dispatchDesc->cameraFovAngleVertical);
-    params->Set("FSR.frameTimeDelta", dispatchDesc->frameTimeDelta);
-    params->Set("FSR.viewSpaceToMetersFactor", dispatchDesc->viewSpaceToMetersFactor);
-    params->Set("FSR.transparencyAndComposition", dispatchDesc->transparencyAndComposition.resource);
-    params->Set("FSR.reactive", dispatchDesc->reactive.resource);
-    params->Set(NVSDK_NGX_Parameter_Sharpness, dispatchDesc->sharpness);
-    params->Set("FSR.upscaleSize.width", dispatchDesc->upscaleSize.width);
-    params->Set("FSR.upscaleSize.height", dispatchDesc->upscaleSize.height);
+    UpscaleFrameInputs inputs {};
+    inputs.JitterX = dispatchDesc->jitterOffset.x;
+    inputs.JitterY = dispatchDesc->jitterOffset.y;
+    inputs.SetMVScale(dispatchDesc->motionVectorScale.x, dispatchDesc->motionVectorScale.y);
+    inputs.PreExposure = dispatchDesc->preExposure;
+    inputs.Reset = dispatchDesc->reset;
+    inputs.SetRenderSize(dispatchDesc->renderSize.width, dispatchDesc->renderSize.height);
+    inputs.Depth = (ID3D12Resource*) dispatchDesc->depth.resource;
+    inputs.Exposure = (ID3D12Resource*) dispatchDesc->exposure.resource;
+    inputs.BiasMask = (ID3D12Resource*) dispatchDesc->reactive.resource;
+    inputs.Color = (ID3D12Resource*) dispatchDesc->color.resource;
+    inputs.MotionVectors = (ID3D12Resource*) dispatchDesc->motionVectors.resource;
+    inputs.Output = (ID3D12Resource*) dispatchDesc->output.resource;
+    inputs.CameraNear = dispatchDesc->cameraNear;
+    inputs.CameraFar = dispatchDesc->cameraFar;
+    inputs.CameraFovVertical = dispatchDesc->cameraFovAngleVertical;
+    inputs.FrameTimeDelta = dispatchDesc->frameTimeDelta;
+    inputs.ViewSpaceToMeters = dispatchDesc->viewSpaceToMetersFactor;
+    inputs.TransparencyAndComposition = (ID3D12Resource*) dispatchDesc->transparencyAndComposition.resource;
+    inputs.Reactive = (ID3D12Resource*) dispatchDesc->reactive.resource;
+    inputs.Sharpness = dispatchDesc->sharpness;
+    inputs.UpscaleWidth = dispatchDesc->upscaleSize.width;
+    inputs.UpscaleHeight = dispatchDesc->upscaleSize.height;
 
     LOG_DEBUG("handle: {:X}, internalResolution: {}x{}", handle->Id, dispatchDesc->renderSize.width,
               dispatchDesc->renderSize.height);
 
     State::Instance().setInputApiName = "FFX-DX12";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     auto evalResult = NVSDK_NGX_D3D12_EvaluateFeature((ID3D12GraphicsCommandList*) dispatchDesc->commandList, handle,
                                                       params, nullptr);
 
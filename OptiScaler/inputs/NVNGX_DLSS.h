@@ -1,8 +1,39 @@
 #pragma once
 
+#include <upscalers/FeatureRetirement.h>
+
+#include <future>
+#include <string>
+#include <vector>
+
+enum class ImGuiToastType : uint8_t;
+
+template <typename FeatureType> struct PendingFeature
+{
+    std::unique_ptr<FeatureType> feature;
+    std::string configName; // Saved as the configured upscaler once the feature is swapped in
+    bool fellBack = false;  // Requested upscaler failed to load, notified once the feature is swapped in
+
+    // Notifications of a failed init, the feature is already dropped on the worker
+    std::vector<std::pair<ImGuiToastType, std::string>> notifications;
+};
+
 template <typename FeatureType> struct ContextData
 {
     std::unique_ptr<FeatureType> feature;
     NVSDK_NGX_Parameter* createParams = nullptr;
     int changeBackendCounter = 0;
+
+    // New feature being created and inited on a worker thread, swapped into feature once ready
+    std::future<PendingFeature<FeatureType>> pendingFeature;
+
+    // Current feature keeps evaluating until the new one is ready.
+    // Cleared when the current one can't be used anymore, like after an output resolution change.
+    bool canServeWhileChanging = true;
+
+    // Replaced features, released once they are not in use anymore
+    FeatureRetirement<FeatureType> retired;
+
+    // Feature was used by a released handle before, its history is reset on the first evaluate
+    bool resetHistory = false;
 };
@@ -534,6 +534,11 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_ReleaseFeature(NVSDK_NGX_Handle*
             std::this_thread::sleep_for(std::chrono::milliseconds(500));
         }
     }
+    else if (auto it = Dx11Contexts.find(handleId); it != Dx11Contexts.end())
+    {
+        // Released during a backend change, only retired features are left
+        Dx11Contexts.erase(it);
+    }
 
     return NVSDK_NGX_Result_Success;
 }
@@ -619,6 +624,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_EvaluateFeature(ID3D11DeviceConte
 
     IFeature_Dx11* deviceContext = nullptr;
     auto activeContext = &Dx11Contexts[handleId];
+    activeContext->retired.Collect();
 
     if (State::Instance().changeBackend[handleId])
     {
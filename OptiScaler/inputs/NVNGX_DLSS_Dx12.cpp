@@ -268,6 +268,12 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_Shutdown(void)
 
     State::Instance().currentFeature = nullptr;
 
+    if (!State::Instance().isShuttingDown)
+    {
+        FeatureProvider_Dx12::DiscardPrewarmed();
+        FeatureProvider_Dx12::ClearPooled();
+    }
+
     // Unhooking and cleaning stuff causing issues during shutdown.
     // Disabled for now to check if it cause any issues
     // UnhookAll();
@@ -521,22 +527,46 @@ static NVSDK_NGX_Result TryCreateOptiFeature(ID3D12GraphicsCommandList* InCmdLis
 
     state.api = DX12;
 
-    const uint32_t handleId = IFeature::GetNextHandleId();
-    LOG_INFO("Creating OptiScaler feature, HandleId: {}", handleId);
-
     // Determine backend name
     std::string featureName;
     if (InFeatureID == NVSDK_NGX_Feature_SuperSampling)
-    {
         featureName = GetUpscalerBackend();
-        LOG_INFO("Creating {} upscaler feature", featureName);
-    }
     else
-    {
         featureName = "dlssd";
-        LOG_INFO("Creating DLSSD (Ray Reconstruction) feature");
+
+    // Ensure D3D12 device, prepared features are only used on the device they were created on
+    if (!EnsureD3D12Device(InCmdList))
+    {
+        LOG_ERROR("Failed to acquire D3D12 device");
+        return NVSDK_NGX_Result_Fail;
+    }
+
+    // Feature might be already built in background after a resize or kept after its handle was released
+    std::unique_ptr<IFeature_Dx12> prepared;
+    bool isPooled = false;
+
+    FeatureProvider_Dx12::CollectPooled();
+
+    if (InFeatureID == NVSDK_NGX_Feature_SuperSampling)
+    {
+        prepared = FeatureProvider_Dx12::TakePrewarmed(D3D12Device, featureName, InParameters);
+
+        if (prepared == nullptr)
+        {
+            prepared = FeatureProvider_Dx12::TakePooled(D3D12Device, featureName, InParameters);
+            isPooled = prepared != nullptr;
+        }
     }
 
+    const bool isPrepared = prepared != nullptr;
+    const uint32_t handleId = isPrepared ? prepared->Handle()->Id : IFeature::GetNextHandleId();
+    LOG_INFO("Creating OptiScaler feature, HandleId: {}", handleId);
+
+    if (InFeatureID == NVSDK_NGX_Feature_SuperSampling)
+        LOG_INFO("Creating {} upscaler feature", featureName);
+    else
+        LOG_INFO("Creating DLSSD (Ray Reconstruction) feature");
+
     // Root signature restoration setup
     const bool restoreCompute = cfg.RestoreComputeSignature.value_or_default();
     const bool restoreGraphic = cfg.RestoreGraphicSignature.value_or_default();
@@ -549,26 +579,18 @@ static NVSDK_NGX_Result TryCreateOptiFeature(ID3D12GraphicsCommandList* InCmdLis
     Dx12Contexts[handleId] = {};
 
     // Retrieve feature implementation
-    if (!FeatureProvider_Dx12::GetFeature(featureName, handleId, InParameters, &Dx12Contexts[handleId].feature))
+    if (isPrepared)
     {
-        LOG_ERROR("Failed to retrieve feature implementation for '{}'", featureName);
-
-        if (shouldRestore)
-            D3D12Hooks::SetRootSignatureTracking(true);
-
-        Dx12Contexts.erase(handleId);
-        return NVSDK_NGX_Result_Fail;
+        Dx12Contexts[handleId].feature = std::move(prepared);
+        Dx12Contexts[handleId].resetHistory = isPooled;
     }
-
-    // Ensure D3D12 device
-    if (!EnsureD3D12Device(InCmdList))
+    else if (!FeatureProvider_Dx12::GetFeature(featureName, handleId, InParameters, &Dx12Contexts[handleId].feature))
     {
-        LOG_ERROR("Failed to acquire D3D12 device");
+        LOG_ERROR("Failed to retrieve feature implementation for '{}'", featureName);
 
         if (shouldRestore)
             D3D12Hooks::SetRootSignatureTracking(true);
 
-        // Partial cleanup � handle is allocated but context is incomplete
         Dx12Contexts.erase(handleId);
         return NVSDK_NGX_Result_Fail;
     }
@@ -583,9 +605,12 @@ static NVSDK_NGX_Result TryCreateOptiFeature(ID3D12GraphicsCommandList* InCmdLis
 
     IFeature_Dx12* feature = Dx12Contexts[handleId].feature.get();
 
-    // Initialize feature
-    if (feature->Init(D3D12Device, InCmdList, InParameters))
+    // Initialize feature, prewarmed and pooled ones are already initialized
+    if (isPrepared || feature->Init(D3D12Device, InCmdList, InParameters))
     {
+        if (!isPrepared)
+            FeatureProvider_Dx12::SetCreationKey(feature, D3D12Device, featureName, InParameters);
+
         state.currentFeature = feature;
         evalCounter = 0;
         UpscalerInputsDx12::Reset();
@@ -738,15 +763,20 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_ReleaseFeature(NVSDK_NGX_Handle*
     {
         auto& entry = it->second;
 
-        if (auto* deviceContext = entry.feature.get())
-        {
-            // Clear global reference if it matches
-            if (deviceContext == State::Instance().currentFeature)
-                State::Instance().currentFeature = nullptr;
+        // Clear global reference if it matches
+        if (auto* deviceContext = entry.feature.get(); deviceContext == State::Instance().currentFeature)
+            State::Instance().currentFeature = nullptr;
 
-            // Erase from map (smart pointer reset is implicit on erase)
-            Dx12Contexts.erase(it);
-        }
+        // Wait for a backend change in progress, the new feature is dropped with the context
+        if (entry.pendingFeature.valid())
+            entry.pendingFeature.wait();
+        else if (!shutdown)
+            FeatureProvider_Dx12::PoolFeature(entry.feature);
+
+        // Erase from map (smart pointer reset is implicit on erase)
+        Dx12Contexts.erase(it);
+
+        FeatureProvider_Dx12::CollectPooled();
     }
     else
     {
@@ -831,6 +861,10 @@ static NVSDK_NGX_Result TryEvaluateOptiFeature(ID3D12GraphicsCommandList* InCmdL
     }
 
     ContextData<IFeature_Dx12>& ctxData = ctxIt->second;
+    ctxData.retired.Collect();
+    FeatureProvider_Dx12::PrewarmTick(D3D12Device, ctxData.feature.get());
+    FeatureProvider_Dx12::CollectPooled();
+
     IFeature_Dx12* feature = ctxData.feature.get();
 
     if (feature == nullptr) // Prevent source api name flicker when dlssg is active
@@ -851,6 +885,31 @@ static NVSDK_NGX_Result TryEvaluateOptiFeature(ID3D12GraphicsCommandList* InCmdL
     if (InCallback)
         LOG_INFO("Progress callback provided but unused in synchronous OptiScaler path");
 
+    // Input translators (FSR, FfxApi, XeSS) provide typed inputs, DLSS callers only have the parameter map
+    UpscaleFrameInputs paramInputs {};
+    std::optional<FrameInputsScope> paramScope;
+    const UpscaleFrameInputs* inputs = FrameInputsScope::Current(InParameters);
+
+    // Pooled feature still has the history of the handle it was released from
+    const bool resetHistory = std::exchange(ctxData.resetHistory, false);
+
+    if (inputs == nullptr)
+    {
+        paramInputs = UpscaleFrameInputs::FromParameters(InParameters);
+
+        // Reset only reaches the map through the sync, game's own value stays untouched otherwise
+        paramInputs.Reset |= resetHistory;
+        paramScope.emplace(paramInputs, InParameters, !resetHistory);
+        inputs = &paramInputs;
+    }
+    else if (resetHistory)
+    {
+        paramInputs = *inputs;
+        paramInputs.Reset = true;
+        paramScope.emplace(paramInputs, InParameters);
+        inputs = &paramInputs;
+    }
+
     // Resolution change detection (only for upscalers that may require recreation)
     if (feature != nullptr)
     {
@@ -858,21 +917,29 @@ static NVSDK_NGX_Result TryEvaluateOptiFeature(ID3D12GraphicsCommandList* InCmdL
             feature->Name().starts_with("FSR") && feature->Version() >= feature_version { 3, 1, 0 };
 
         // FSR 3.1 supports upscaleSize that doesn't need reinit to change output resolution
-        if (!isFSR31OrLater && feature->UpdateOutputResolution(InParameters))
+        if (!isFSR31OrLater && feature->UpdateOutputResolution(*inputs))
+        {
             state.changeBackend[handleId] = true;
+            ctxData.canServeWhileChanging = false;
+        }
     }
 
     // Backend change or recreation requested
     if (state.changeBackend[handleId])
     {
-        UpscalerInputsDx12::Reset();
-        D3D12Hooks::SetRootSignatureTracking(true);
-
+        FrameInputsScope::SyncParameters();
         FeatureProvider_Dx12::ChangeFeature(state.newBackend, D3D12Device, InCmdList, handleId, InParameters, &ctxData);
         feature = ctxData.feature.get();
 
-        evalCounter = 0;
-        return NVSDK_NGX_Result_Success;
+        // New feature is created in the background, keep using the current one until it's ready
+        if (!state.changeBackend[handleId] || feature == nullptr || !feature->IsInited())
+        {
+            UpscalerInputsDx12::Reset();
+            D3D12Hooks::SetRootSignatureTracking(true);
+
+            evalCounter = 0;
+            return NVSDK_NGX_Result_Success;
+        }
     }
 
     // Fallback to FSR 2.1.2 if feature failed to initialize and user didn't explicitly request it
@@ -896,9 +963,17 @@ static NVSDK_NGX_Result TryEvaluateOptiFeature(ID3D12GraphicsCommandList* InCmdL
         D3D12Hooks::SetRootSignatureTracking(false);
 
     // Prepare upscaling inputs
-    UpscalerInputsDx12::UpscaleStart(InCmdList, InParameters, feature);
+    UpscalerInputsDx12::UpscaleStart(InCmdList, *inputs, feature);
+
+    if (state.activeFgInput == FGInput::FSRFG30)
+        FrameInputsScope::SyncParameters();
+
     FSR3FG::SetUpscalerInputs(InCmdList, InParameters, feature);
 
+    // Backends which are not ported to the typed inputs still read the parameter map
+    if (!feature->UsesFrameInputs())
+        FrameInputsScope::SyncParameters();
+
     // Record the first timestamp
     UpscalerTimeDx12::UpscaleStart(InCmdList);
 
@@ -916,7 +991,7 @@ static NVSDK_NGX_Result TryEvaluateOptiFeature(ID3D12GraphicsCommandList* InCmdL
         // Record the second timestamp
         UpscalerTimeDx12::UpscaleEnd(InCmdList);
 
-        UpscalerInputsDx12::UpscaleEnd(InCmdList, InParameters, feature);
+        UpscalerInputsDx12::UpscaleEnd(InCmdList, *inputs, feature);
     }
     else
     {
@@ -969,6 +1044,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
     // Native DLSS passthrough
     if (handleId < DLSS_MOD_ID_OFFSET)
     {
+        FrameInputsScope::SyncParameters();
+
         if (cfg.DLSSEnabled.value_or_default() && NVNGXProxy::D3D12_EvaluateFeature() != nullptr)
         {
             LOG_DEBUG("Passthrough to native DLSS EvaluateFeature for handle {}", handleId);
@@ -986,6 +1063,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
     if (state.activeFgInput == FGInput::Nukems && handleId >= DLSSG_MOD_ID_OFFSET)
     {
         LOG_DEBUG("Passthrough to Nukem's DLSSG EvaluateFeature for handle {}", handleId);
+        FrameInputsScope::SyncParameters();
         return DLSSGMod::D3D12_EvaluateFeature(InCmdList, InFeatureHandle, InParameters, InCallback);
     }
 
@@ -840,6 +840,12 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_ReleaseFeature(NVSDK_NGX_Handle*
                                [&handleId](const auto& p) { return p.first == handleId; });
         VkContexts.erase(it);
     }
+    else if (auto it = VkContexts.find(handleId); it != VkContexts.end())
+    {
+        // Released during a backend change, only retired features are left
+        vkDeviceWaitIdle(vkDevice);
+        VkContexts.erase(it);
+    }
 
     std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
@@ -918,6 +924,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer
 
     IFeature_Vk* deviceContext = nullptr;
     auto contextData = &VkContexts[handleId];
+    contextData->retired.Collect();
 
     if (State::Instance().changeBackend[handleId])
     {
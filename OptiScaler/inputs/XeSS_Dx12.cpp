@@ -2,6 +2,7 @@
 #include "XeSS_Dx12.h"
 
 #include "NVNGX_Parameter.h"
+#include "upscalers/UpscaleFrameInputs.h"
 
 #include <proxies/XeSS_Proxy.h>
 #include "menu/menu_overlay_dx.h"
@@ -206,6 +207,8 @@ xess_result_t hk_xessD3D12Execute(xess_context_handle_t hContext, ID3D12Graphics
     NVSDK_NGX_Handle* handle = _contexts[hContext];
     xess_d3d12_init_params_t* initParams = &_d3d12InitParams[hContext];
 
+    UpscaleFrameInputs inputs {};
+
     if (_motionScales.contains(hContext))
     {
         auto scales = &_motionScales[hContext];
@@ -214,19 +217,18 @@ xess_result_t hk_xessD3D12Execute(xess_context_handle_t hContext, ID3D12Graphics
         {
             if (initParams->initFlags & XESS_INIT_FLAG_HIGH_RES_MV)
             {
-                params->Set(NVSDK_NGX_Parameter_MV_Scale_X, initParams->outputResolution.x * 0.5 * scales->x);
-                params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, initParams->outputResolution.y * -0.5 * scales->y);
+                inputs.SetMVScale((float) (initParams->outputResolution.x * 0.5 * scales->x),
+                                  (float) (initParams->outputResolution.y * -0.5 * scales->y));
             }
             else
             {
-                params->Set(NVSDK_NGX_Parameter_MV_Scale_X, pExecParams->inputWidth * 0.5 * scales->x);
-                params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, pExecParams->inputHeight * -0.5 * scales->y);
+                inputs.SetMVScale((float) (pExecParams->inputWidth * 0.5 * scales->x),
+                                  (float) (pExecParams->inputHeight * -0.5 * scales->y));
             }
         }
         else
         {
-            params->Set(NVSDK_NGX_Parameter_MV_Scale_X, scales->x);
-            params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, scales->y);
+            inputs.SetMVScale(scales->x, scales->y);
         }
     }
 
@@ -240,27 +242,25 @@ xess_result_t hk_xessD3D12Execute(xess_context_handle_t hContext, ID3D12Graphics
         jitterScaleY = scales->y;
     }
 
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, pExecParams->jitterOffsetX * jitterScaleX);
-    params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, pExecParams->jitterOffsetY * jitterScaleY);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, pExecParams->exposureScale);
-    params->Set(NVSDK_NGX_Parameter_Reset, pExecParams->resetHistory);
-    params->Set(NVSDK_NGX_Parameter_Width, pExecParams->inputWidth);
-    params->Set(NVSDK_NGX_Parameter_Height, pExecParams->inputHeight);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, pExecParams->inputWidth);
-    params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, pExecParams->inputHeight);
-    params->Set(NVSDK_NGX_Parameter_Depth, pExecParams->pDepthTexture);
-    params->Set(NVSDK_NGX_Parameter_ExposureTexture, pExecParams->pExposureScaleTexture);
+    inputs.JitterX = pExecParams->jitterOffsetX * jitterScaleX;
+    inputs.JitterY = pExecParams->jitterOffsetY * jitterScaleY;
+    inputs.ExposureScale = pExecParams->exposureScale;
+    inputs.Reset = pExecParams->resetHistory != 0;
+    inputs.SetRenderSize(pExecParams->inputWidth, pExecParams->inputHeight);
+    inputs.Depth = pExecParams->pDepthTexture;
+    inputs.Exposure = pExecParams->pExposureScaleTexture;
 
     if (feature_version { XeSSProxy::Version().major, XeSSProxy::Version().minor, XeSSProxy::Version().patch } <
         feature_version { 2, 0, 1 })
-        params->Set(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, pExecParams->pResponsivePixelMaskTexture);
+        inputs.BiasMask = pExecParams->pResponsivePixelMaskTexture;
     else
-        params->Set("FSR.reactive", pExecParams->pResponsivePixelMaskTexture);
+        inputs.Reactive = pExecParams->pResponsivePixelMaskTexture;
 
-    params->Set(NVSDK_NGX_Parameter_Color, pExecParams->pColorTexture);
-    params->Set(NVSDK_NGX_Parameter_MotionVectors, pExecParams->pVelocityTexture);
-    params->Set(NVSDK_NGX_Parameter_Output, pExecParams->pOutputTexture);
+    inputs.Color = pExecParams->pColorTexture;
+    inputs.MotionVectors = pExecParams->pVelocityTexture;
+    inputs.Output = pExecParams->pOutputTexture;
 
+    // Subrect bases are only read by the XeSS and DLSS backends which still use the parameter map
     params->Set(NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X, pExecParams->inputColorBase.x);
     params->Set(NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y, pExecParams->inputColorBase.y);
     params->Set(NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X, pExecParams->inputDepthBase.x);
@@ -276,6 +276,8 @@ xess_result_t hk_xessD3D12Execute(xess_context_handle_t hContext, ID3D12Graphics
 
     State::Instance().setInputApiName = "XeSS";
 
+    FrameInputsScope inputsScope(inputs, params);
+
     if (NVSDK_NGX_D3D12_EvaluateFeature(pCommandList, handle, params, nullptr) == NVSDK_NGX_Result_Success)
         return XESS_RESULT_SUCCESS;
 
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+
+// Tracks which overlay frames in flight are still used by the GPU.
+// Slots are used in submission order instead of by swapchain image index, so a present engine which
+// returns images out of order doesn't make us wait on a frame that was just submitted.
+// Fence calls go through Dispatch so this doesn't depend on Vulkan:
+//   bool IsSignaled(FenceType fence)
+//   void Wait(FenceType fence)
+template <typename FenceType, uint32_t MaxFrames = 8> class OverlayFrameRing
+{
+    FenceType _fences[MaxFrames] {};
+    bool _pending[MaxFrames] {};
+    uint32_t _count = 0;
+    uint32_t _next = 0;
+
+  public:
+    void Init(uint32_t count)
+    {
+        _count = count < MaxFrames ? count : MaxFrames;
+        _next = 0;
+
+        for (uint32_t i = 0; i < MaxFrames; i++)
+        {
+            _fences[i] = {};
+            _pending[i] = false;
+        }
+    }
+
+    uint32_t Count() const { return _count; }
+    void SetFence(uint32_t slot, FenceType fence) { _fences[slot] = fence; }
+    bool IsPending(uint32_t slot) const { return _pending[slot]; }
+
+    // Returns the slot to record into, only waits if its last submission is still running
+    template <typename Dispatch> uint32_t Acquire(Dispatch& dispatch)
+    {
+        auto slot = _next;
+
+        if (_pending[slot])
+        {
+            if (!dispatch.IsSignaled(_fences[slot]))
+                dispatch.Wait(_fences[slot]);
+
+            _pending[slot] = false;
+        }
+
+        return slot;
+    }
+
+    // Fence of the slot was passed to the submit, next Acquire moves to the following slot
+    void Submitted(uint32_t slot)
+    {
+        _pending[slot] = true;
+        _next = (slot + 1) % _count;
+    }
+
+    // Waits for every submission which is still running
+    template <typename Dispatch> void WaitAll(Dispatch& dispatch)
+    {
+        for (uint32_t i = 0; i < _count; i++)
+        {
+            if (_pending[i] && !dispatch.IsSignaled(_fences[i]))
+                dispatch.Wait(_fences[i]);
+
+            _pending[i] = false;
+        }
+    }
+};
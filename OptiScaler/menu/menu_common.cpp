@@ -25,6 +25,7 @@
 #include <array>
 #include <chrono>
 #include <misc/IdentifyGpu.h>
+#include <upscalers/RenderScaleGovernor.h>
 
 #define MARK_ALL_BACKENDS_CHANGED()                                                                                    \
     for (auto& singleChangeBackend : State::Instance().changeBackend)                                                  \
@@ -36,10 +37,11 @@ static ImVec2 overlayPosition(-1000.0f, -1000.0f);
 static bool _hdrTonemapApplied = false;
 static ImVec4 SdrColors[ImGuiCol_COUNT];
 static bool receivingWmInputs = false;
-static bool inputMenu = false;
-static bool inputFG = false;
-static bool inputFps = false;
-static bool inputFpsCycle = false;
+// Set from window messages, read on present
+static std::atomic<bool> inputMenu = false;
+static std::atomic<bool> inputFG = false;
+static std::atomic<bool> inputFps = false;
+static std::atomic<bool> inputFpsCycle = false;
 static bool hasGamepad = false;
 static bool fsr31InitTried = false;
 static bool xefgInitTried = false;
@@ -1440,11 +1442,37 @@ inline static std::string GetDispatchString(UINT source)
 static double lastTime = 0.0;
 static UINT64 uwpTargetFrame = 0;
 
+bool MenuCommon::IsIdle()
+{
+    // ImGui notifications are only touched by the render thread, other threads just see it as busy
+    if (!_idle.load(std::memory_order_acquire) ||
+        _idleThread.load(std::memory_order_relaxed) != std::this_thread::get_id())
+    {
+        return false;
+    }
+
+    if (inputMenu.load(std::memory_order_relaxed) || inputFps.load(std::memory_order_relaxed) ||
+        inputFG.load(std::memory_order_relaxed) || inputFpsCycle.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    return ImGui::notifications.empty() &&
+           State::Instance().versionCheckGeneration.load(std::memory_order_acquire) == _versionCheckGeneration;
+}
+
 bool MenuCommon::RenderMenu()
 {
     if (!_isInited)
         return false;
 
+    // Nothing is shown, skip the frame until a hotkey, notification or version check result
+    if (IsIdle())
+    {
+        lastTime = 0.0;
+        return false;
+    }
+
     auto& state = State::Instance();
     auto config = Config::Instance();
 
@@ -1559,7 +1587,7 @@ bool MenuCommon::RenderMenu()
     constexpr int updateNoticeTime = 60000;
     static std::string splashMessage;
 
-    // Version check
+    // Version check, results are only copied when a new one is published
     struct VersionCheckStatus
     {
         bool completed = false;
@@ -1567,8 +1595,13 @@ bool MenuCommon::RenderMenu()
         std::string latestTag;
         std::string latestUrl;
         std::string error;
-    } versionStatus;
+    };
+
+    static VersionCheckStatus versionStatus;
+    bool versionStatusChanged = false;
 
+    if (auto generation = state.versionCheckGeneration.load(std::memory_order_acquire);
+        generation != _versionCheckGeneration)
     {
         std::scoped_lock lock(state.versionCheckMutex);
         versionStatus.completed = state.versionCheckCompleted;
@@ -1576,11 +1609,15 @@ bool MenuCommon::RenderMenu()
         versionStatus.latestTag = state.latestVersionTag;
         versionStatus.latestUrl = state.latestVersionUrl;
         versionStatus.error = state.versionCheckError;
+
+        _versionCheckGeneration = generation;
+        versionStatusChanged = true;
     }
 
     const auto& currentVersionText = VersionCheck::CurrentVersionString();
 
-    if (versionStatus.completed && versionStatus.updateAvailable && !versionStatus.latestTag.empty())
+    if (versionStatusChanged && versionStatus.completed && versionStatus.updateAvailable &&
+        !versionStatus.latestTag.empty())
     {
         if (updateNoticeTag != versionStatus.latestTag)
         {
@@ -1609,9 +1646,11 @@ bool MenuCommon::RenderMenu()
         splashMessage = splashText[std::rand() % splashText.size()];
     }
 
+    bool splashActive = !config->DisableSplash.value_or_default() && now < splashLimit;
+
     // New frame check
-    if ((!config->DisableSplash.value_or_default() && now > splashStart && now < splashLimit) ||
-        config->ShowFps.value_or_default() || _isVisible)
+    if ((splashActive && now > splashStart) || config->ShowFps.value_or_default() || _isVisible ||
+        !ImGui::notifications.empty())
     {
         if (!_isUWP)
         {
@@ -1995,7 +2034,19 @@ bool MenuCommon::RenderMenu()
             {
                 constexpr auto delayBetweenPollsMs = 500;
                 static auto previousPoll = 0.0;
+                static auto previousDraw = 0.0;
                 static bool gotData = false;
+
+                // Timings were not visible for a while, don't show the old data
+                if (previousDraw + delayBetweenPollsMs < now)
+                {
+                    ReflexHooks::resetTimingData();
+                    gotData = false;
+                    previousPoll = 0.0;
+                }
+
+                previousDraw = now;
+
                 if (previousPoll <= 0.001 || previousPoll + delayBetweenPollsMs < now)
                 {
                     gotData = ReflexHooks::updateTimingData();
@@ -2414,6 +2465,17 @@ bool MenuCommon::RenderMenu()
                         ImGui::EndDisabled();
                     }
 
+                    if (state.api == DX12 && currentFeature->Name() != "DLSSD")
+                    {
+                        bool prewarm = config->UpscalerPrewarm.value_or_default();
+                        if (ImGui::Checkbox("Prewarm On Resize", &prewarm))
+                            config->UpscalerPrewarm = prewarm;
+                        ShowHelpMarker("Build the upscaler for the new resolution in background\n"
+                                       "after a resize to prevent the stutter of its creation\n"
+                                       "Experimental, off by default\n"
+                                       "Not used with DLSS");
+                    }
+
                     if (primaryGpu.dlssCapable && !state.NVNGX_DLSS_Path.has_value())
                     {
                         ImGui::Spacing();
@@ -2459,6 +2521,13 @@ bool MenuCommon::RenderMenu()
                                 ImGui::Checkbox("Use CopyResource for Output", &outputUseCopy))
                                 config->VulkanUseCopyForOutput = outputUseCopy;
 
+                            if (bool aliasInputs = config->VulkanAliasInputs.value_or_default();
+                                ImGui::Checkbox("Alias Exported Inputs", &aliasInputs))
+                                config->VulkanAliasInputs = aliasInputs;
+
+                            ShowHelpMarker("Skips input copies when game images are\n"
+                                           "allocated as exportable D3D12 resources");
+
                             ImGui::Spacing();
                             ImGui::Spacing();
                         }
@@ -3554,6 +3623,13 @@ bool MenuCommon::RenderMenu()
                                         config->FGFPTAllowWaitForSingleObjectOnFence = fpWaitForSingleObjectOnFence;
                                     ShowHelpMarker("Allows WaitForSingleObject instead of spinning for fence value");
 
+                                    auto fptAutoTune = config->FGFPTAutoTune.value_or_default();
+                                    if (ImGui::Checkbox("Auto Tune", &fptAutoTune))
+                                        config->FGFPTAutoTune = fptAutoTune;
+                                    ShowHelpMarker("Adjusts safety margin, variance factor and hybrid spin\n"
+                                                   "from the displayed frames while playing\n"
+                                                   "Values above are used as starting point");
+
                                     if (ImGui::Button("Apply Timing Changes"))
                                         state.FSRFGFTPchanged = true;
 
@@ -3869,6 +3945,13 @@ bool MenuCommon::RenderMenu()
                             config->FGResourceFlipOffset = resourceFlipOffset;
                         ShowHelpMarker("Use height difference as offset");
 
+                        bool asyncPrep = config->FGAsyncPrep.value_or_default();
+                        if (ImGui::Checkbox("Async Prep", &asyncPrep))
+                            config->FGAsyncPrep = asyncPrep;
+                        ShowHelpMarker("Run Velocity & Depth flips on a separate compute queue\n"
+                                       "Only used for inputs which stay valid until present\n"
+                                       "and with upscaler FG inputs");
+
                         ImGui::Spacing();
 
                         if (auto ch = ScopedCollapsingHeader("Advanced OptiFG Settings"); ch.IsHeaderOpen())
@@ -4030,6 +4113,14 @@ bool MenuCommon::RenderMenu()
                                 ShowHelpMarker("Make a copy of depth to use with OptiFG\n"
                                                "For preventing corruptions that might happen");
 
+                                bool copyElision = config->FGCopyElision.value_or_default();
+                                if (ImGui::Checkbox("FG Skip Unneeded Copies", &copyElision))
+                                    config->FGCopyElision = copyElision;
+                                ShowHelpMarker("Skip MV and depth copies when the game doesn't\n"
+                                               "write them between upscaling and present\n"
+                                               "Copies are made again if a write is detected\n"
+                                               "Frame of the detected write is generated wrong");
+
                                 ImGui::PushItemWidth(115.0f * menuResScale);
                                 float depthScaleMax = config->FGDepthScaleMax.value_or_default();
                                 if (ImGui::InputFloat("FG Scale Depth Max", &depthScaleMax, 10.0f, 100.0f, "%.1f"))
@@ -4457,6 +4548,15 @@ bool MenuCommon::RenderMenu()
 
                     ImGui::BeginDisabled(!usingLFX);
                     PopulateCombo("LatencyFlex mode", config->FN_LatencyFlexMode, lfx_modes);
+
+                    if (bool lfxGpuFeedback = config->FN_LatencyFlexGpuFeedback.value_or_default();
+                        ImGui::Checkbox("LatencyFlex GPU Feedback", &lfxGpuFeedback))
+                    {
+                        config->FN_LatencyFlexGpuFeedback = lfxGpuFeedback;
+                    }
+                    ShowHelpMarker("Ends frames when the GPU finishes them instead of when they are submitted\n"
+                                   "Helps pacing in GPU bound games, DirectX 12 only");
+
                     ImGui::EndDisabled();
 
                     static std::vector<MenuOption<ForceReflex>> reflex_modes = { { ForceReflex::InGame, "Follow in-game" },
@@ -4986,6 +5086,34 @@ bool MenuCommon::RenderMenu()
                         ImGui::EndTable();
                     }
 
+                    if (bool governor = config->DrsGovernorEnabled.value_or_default();
+                        ImGui::Checkbox("Resolution Governor", &governor))
+                    {
+                        config->DrsGovernorEnabled = governor;
+                    }
+
+                    ShowHelpMarker("Caps the game's DRS maximum at the resolution picked for the target fps\n"
+                                   "Governed resolution stays inside the min/max ratio range\n"
+                                   "Only works with games which use DLSS DRS limits while running");
+
+                    if (config->DrsGovernorEnabled.value_or_default())
+                    {
+                        float targetFps = config->DrsGovernorTargetFps.value_or_default();
+                        if (ImGui::SliderFloat("Target FPS", &targetFps, 20.0f, 240.0f, "%.0f"))
+                            config->DrsGovernorTargetFps = targetFps;
+
+                        float minRatio = config->DrsGovernorMinRatio.value_or_default();
+                        if (ImGui::SliderFloat("Min Ratio", &minRatio, 1.0f, 3.0f, "%.2f"))
+                            config->DrsGovernorMinRatio = minRatio;
+
+                        float maxRatio = config->DrsGovernorMaxRatio.value_or_default();
+                        if (ImGui::SliderFloat("Max Ratio", &maxRatio, 1.0f, 3.0f, "%.2f"))
+                            config->DrsGovernorMaxRatio = maxRatio;
+
+                        if (RenderScaleGovernor::Active())
+                            ImGui::Text("DRS max scale: %.0f%%", RenderScaleGovernor::Scale() * 100.0f);
+                    }
+
                     // Non-DLSS hotfixes -----------------------------
                     if (currentFeature != nullptr && !currentFeature->IsFrozen() && currentBackend != "dlss")
                     {
@@ -5819,6 +5947,11 @@ bool MenuCommon::RenderMenu()
     if (newFrame)
         ImGui::EndFrame();
 
+    // Expired notifications are removed while rendering, so this is checked last
+    _idleThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    _idle.store(!_isVisible && !config->ShowFps.value_or_default() && !splashActive && ImGui::notifications.empty(),
+                std::memory_order_release);
+
     return newFrame;
 }
 
@@ -12,6 +12,9 @@
 
 #include <detours/detours.h>
 
+#include <atomic>
+#include <thread>
+
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
 class ScopedIndent
@@ -100,6 +103,11 @@ class MenuCommon
 
     inline static UINT64 _frameCount = 0;
 
+    // idle mode, nothing was drawn last frame and nothing is waiting to be shown
+    inline static std::atomic<bool> _idle = false;
+    inline static std::atomic<std::thread::id> _idleThread {};
+    inline static uint32_t _versionCheckGeneration = 0;
+
     // reflex
     inline static float _limitFps = std::numeric_limits<float>::infinity();
 
@@ -196,6 +204,9 @@ class MenuCommon
     static bool IsVisible() { return _isVisible; }
     static HWND Handle() { return _handle; }
 
+    // True when RenderMenu would skip the frame, always false outside the thread which renders the menu
+    static bool IsIdle();
+
     static bool RenderMenu();
     static void Init(HWND InHwnd, bool isUWP);
     static void Shutdown();
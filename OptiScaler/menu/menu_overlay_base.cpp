@@ -21,6 +21,8 @@ bool MenuOverlayBase::IsInited() { return MenuCommon::IsInited(); }
 
 bool MenuOverlayBase::IsVisible() { return MenuCommon::IsVisible(); }
 
+bool MenuOverlayBase::IsIdle() { return MenuCommon::IsIdle(); }
+
 void MenuOverlayBase::Init(HWND InHandle, bool isUWP)
 {
     if (!Config::Instance()->OverlayMenu.value_or_default())
@@ -16,6 +16,7 @@ class MenuOverlayBase
 
     static bool IsInited();
     static bool IsVisible();
+    static bool IsIdle();
 
     static void Init(HWND InHandle, bool isUWP);
     static bool RenderMenu();
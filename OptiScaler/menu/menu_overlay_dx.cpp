@@ -556,6 +556,10 @@ void MenuOverlayDx::Present(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
     if (!Config::Instance()->OverlayMenu.value_or_default())
         return;
 
+    // Nothing to draw, device queries and backend frames can wait
+    if (_isInited && MenuOverlayBase::Handle() == hWnd && MenuOverlayBase::IsIdle())
+        return;
+
     LOG_DEBUG("");
 
     ID3D12CommandQueue* cq = nullptr;
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "menu_overlay_base.h"
 #include "menu_overlay_vk.h"
+#include "OverlayFrameRing.h"
 
 #include <Util.h>
 #include <Config.h>
@@ -19,13 +20,32 @@ static bool _vulkanObjectsCreated = false;
 static std::mutex _vkCleanMutex;
 static std::mutex _vkPresentMutex;
 
+// Command buffers, fences and semaphores are used per frame in flight, not per swapchain image
+struct OverlayFrame
+{
+    VkCommandPool CommandPool = VK_NULL_HANDLE;
+    VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+    VkFence Fence = VK_NULL_HANDLE;
+    VkSemaphore Semaphore = VK_NULL_HANDLE;
+};
+
+struct OverlayFenceDispatch
+{
+    VkDevice Device;
+
+    bool IsSignaled(VkFence fence) { return vkGetFenceStatus(Device, fence) == VK_SUCCESS; }
+    void Wait(VkFence fence) { vkWaitForFences(Device, 1, &fence, VK_TRUE, UINT64_MAX); }
+};
+
+constexpr uint32_t MaxOverlayFrames = 8;
+
 // imgui stuff
 struct ImGui_ImplVulkan_InitInfo _ImVulkan_Info = {};
-struct ImGui_ImplVulkanH_Frame* _ImVulkan_Frames = VK_NULL_HANDLE;
-static VkSemaphore* _ImVulkan_Semaphores = VK_NULL_HANDLE;
+struct ImGui_ImplVulkanH_Frame* _ImVulkan_Frames = VK_NULL_HANDLE; // Only Backbuffer, BackbufferView & Framebuffer
+static OverlayFrame _overlayFrames[MaxOverlayFrames] = {};
+static OverlayFrameRing<VkFence, MaxOverlayFrames> _frameRing;
 static VkRenderPass _vkRenderPass = VK_NULL_HANDLE;
 static uint32_t _scImageCount;
-static ULONG64 _frameCount;
 
 static void SetVkObjectName(VkDevice device, VkInstance instance, VkObjectType objectType, uint64_t objectHandle,
                             const char* name)
@@ -94,7 +114,13 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
         return;
     }
 
-    VkImage images[8];
+    if (_scImageCount > MaxOverlayFrames)
+    {
+        LOG_WARN("Swapchain image count {} is more than supported, using first {}", _scImageCount, MaxOverlayFrames);
+        _scImageCount = MaxOverlayFrames;
+    }
+
+    VkImage images[MaxOverlayFrames];
     result = vkGetSwapchainImagesKHR(device, *pSwapchain, &_scImageCount, images);
     if (result != VK_SUCCESS)
     {
@@ -102,14 +128,20 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
         return;
     }
 
-    // Alloc ImGui frame structure/semaphores for every image.
+    // Alloc ImGui frame structure for every image.
     // For convenience, I am using ImGui_ImplVulkanH_Frame in imgui_impl_vulkan.h
     if (!_vulkanObjectsCreated)
     {
+        if (_ImVulkan_Frames != VK_NULL_HANDLE)
+            IM_FREE(_ImVulkan_Frames);
+
         _ImVulkan_Frames = (ImGui_ImplVulkanH_Frame*) IM_ALLOC(sizeof(ImGui_ImplVulkanH_Frame) * _scImageCount);
-        _ImVulkan_Semaphores = (VkSemaphore*) IM_ALLOC(sizeof(VkSemaphore) * _scImageCount);
+        memset(_ImVulkan_Frames, 0, sizeof(ImGui_ImplVulkanH_Frame) * _scImageCount);
     }
 
+    // One frame in flight per image, same as ImGui's vertex/index buffer ring
+    _frameRing.Init(_scImageCount);
+
     // Select queue family.
     uint32_t queueFamily = 0;
     {
@@ -280,11 +312,11 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
         }
     }
 
-    // Create command pools, command buffers, fences, and semaphores for every image
-    for (uint32_t i = 0; i < _scImageCount; i++)
+    // Create command pools, command buffers, fences, and semaphores for every frame in flight
+    for (uint32_t i = 0; i < _frameRing.Count(); i++)
     {
-        ImGui_ImplVulkanH_Frame* fd = &_ImVulkan_Frames[i];
-        VkSemaphore* fsd = &_ImVulkan_Semaphores[i];
+        OverlayFrame* fd = &_overlayFrames[i];
+        VkSemaphore* fsd = &fd->Semaphore;
         {
             VkCommandPoolCreateInfo info = {};
             info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -323,9 +355,9 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
         }
 
         {
+            // Created unsignaled, ring only waits on fences which were passed to a submit
             VkFenceCreateInfo info = {};
             info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-            info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
             result = vkCreateFence(device, &info, NULL, &fd->Fence);
             if (result != VK_SUCCESS)
             {
@@ -333,6 +365,8 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
                 return;
             }
 
+            _frameRing.SetFence(i, fd->Fence);
+
 #ifdef VULKAN_DEBUG_LAYER
             SetVkObjectName(device, instance, VK_OBJECT_TYPE_FENCE, (UINT64) fd->Fence, "ImGui Backbuffer Fence");
 #endif
@@ -376,8 +410,8 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
 
         // Upload Fonts
         // Use any command queue
-        VkCommandPool command_pool = _ImVulkan_Frames[0].CommandPool;
-        VkCommandBuffer command_buffer = _ImVulkan_Frames[0].CommandBuffer;
+        VkCommandPool command_pool = _overlayFrames[0].CommandPool;
+        VkCommandBuffer command_buffer = _overlayFrames[0].CommandBuffer;
         result = vkResetCommandPool(device, command_pool, 0);
         if (result != VK_SUCCESS)
         {
@@ -452,9 +486,12 @@ void MenuOverlayVk::DestroyVulkanObjects(bool shutdown)
             vkDestroyDescriptorPool(_ImVulkan_Info.Device, _ImVulkan_Info.DescriptorPool, VK_NULL_HANDLE);
     }
 
-    for (uint32_t i = 0; i < _ImVulkan_Info.ImageCount; i++)
+    // Everything is idle after vkDeviceWaitIdle
+    _frameRing.Init(0);
+
+    for (uint32_t i = 0; i < MaxOverlayFrames; i++)
     {
-        ImGui_ImplVulkanH_Frame* fd = &_ImVulkan_Frames[i];
+        OverlayFrame* fd = &_overlayFrames[i];
 
         if (fd->Fence != VK_NULL_HANDLE)
         {
@@ -474,22 +511,27 @@ void MenuOverlayVk::DestroyVulkanObjects(bool shutdown)
             fd->CommandPool = VK_NULL_HANDLE;
         }
 
-        if (fd->BackbufferView != VK_NULL_HANDLE)
+        if (fd->Semaphore != VK_NULL_HANDLE)
         {
-            vkDestroyImageView(_ImVulkan_Info.Device, fd->BackbufferView, VK_NULL_HANDLE);
-            fd->BackbufferView = VK_NULL_HANDLE;
+            vkDestroySemaphore(_ImVulkan_Info.Device, fd->Semaphore, VK_NULL_HANDLE);
+            fd->Semaphore = VK_NULL_HANDLE;
         }
+    }
 
-        if (fd->BackbufferView != VK_NULL_HANDLE)
+    for (uint32_t i = 0; i < _ImVulkan_Info.ImageCount && _ImVulkan_Frames != VK_NULL_HANDLE; i++)
+    {
+        ImGui_ImplVulkanH_Frame* fd = &_ImVulkan_Frames[i];
+
+        if (fd->Framebuffer != VK_NULL_HANDLE)
         {
             vkDestroyFramebuffer(_ImVulkan_Info.Device, fd->Framebuffer, VK_NULL_HANDLE);
             fd->Framebuffer = VK_NULL_HANDLE;
         }
 
-        if (_ImVulkan_Semaphores[i] != VK_NULL_HANDLE)
+        if (fd->BackbufferView != VK_NULL_HANDLE)
         {
-            vkDestroySemaphore(_ImVulkan_Info.Device, _ImVulkan_Semaphores[i], VK_NULL_HANDLE);
-            _ImVulkan_Semaphores[i] = VK_NULL_HANDLE;
+            vkDestroyImageView(_ImVulkan_Info.Device, fd->BackbufferView, VK_NULL_HANDLE);
+            fd->BackbufferView = VK_NULL_HANDLE;
         }
     }
 
@@ -518,11 +560,7 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
     (void) io;
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
 
-    _frameCount++;
-
     {
-        auto semaphoreIndex = _frameCount % _scImageCount;
-
         ImGui_ImplVulkan_NewFrame();
 
         if (State::Instance().delayMenuRenderBy > 0)
@@ -530,13 +568,36 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
 
         if (MenuOverlayBase::RenderMenu())
         {
+            // RenderMenu expects this even when nothing will be drawn
+            ImGui::Render();
+
             if (State::Instance().delayMenuRenderBy == 0)
             {
+                auto drawData = ImGui::GetDrawData();
+
+                bool hasTextureUpdates = false;
+                if (drawData->Textures != nullptr)
+                {
+                    for (ImTextureData* tex : *drawData->Textures)
+                    {
+                        if (tex->Status != ImTextureStatus_OK)
+                        {
+                            hasTextureUpdates = true;
+                            break;
+                        }
+                    }
+                }
+
+                // Nothing to draw, leave the present untouched
+                if (drawData->CmdListsCount == 0 && !hasTextureUpdates)
+                    return true;
+
                 uint32_t idx = pPresentInfo->pImageIndices[0];
-                ImGui_ImplVulkanH_Frame* fd = &_ImVulkan_Frames[idx];
+                ImGui_ImplVulkanH_Frame* fb = &_ImVulkan_Frames[idx];
 
-                vkWaitForFences(_ImVulkan_Info.Device, 1, &fd->Fence, VK_TRUE, UINT64_MAX);
-                vkResetFences(_ImVulkan_Info.Device, 1, &fd->Fence);
+                OverlayFenceDispatch dispatch { _ImVulkan_Info.Device };
+                auto slot = _frameRing.Acquire(dispatch);
+                OverlayFrame* fd = &_overlayFrames[slot];
 
                 {
                     vkResetCommandPool(_ImVulkan_Info.Device, fd->CommandPool, 0);
@@ -550,14 +611,13 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
                     VkRenderPassBeginInfo info = {};
                     info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
                     info.renderPass = _vkRenderPass;
-                    info.framebuffer = fd->Framebuffer;
+                    info.framebuffer = fb->Framebuffer;
                     info.renderArea.extent.width = static_cast<uint32_t>(ImGui::GetIO().DisplaySize.x);
                     info.renderArea.extent.height = static_cast<uint32_t>(ImGui::GetIO().DisplaySize.y);
                     vkCmdBeginRenderPass(fd->CommandBuffer, &info, VK_SUBPASS_CONTENTS_INLINE);
                 }
 
-                ImGui::Render();
-                ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), fd->CommandBuffer);
+                ImGui_ImplVulkan_RenderDrawData(drawData, fd->CommandBuffer);
 
                 // Submit command buffer
                 vkCmdEndRenderPass(fd->CommandBuffer);
@@ -580,7 +640,9 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
                 submit_info.waitSemaphoreCount = pPresentInfo->waitSemaphoreCount;
                 submit_info.pWaitSemaphores = pPresentInfo->pWaitSemaphores;
                 submit_info.signalSemaphoreCount = 1;
-                submit_info.pSignalSemaphores = &_ImVulkan_Semaphores[semaphoreIndex];
+                submit_info.pSignalSemaphores = &fd->Semaphore;
+
+                vkResetFences(_ImVulkan_Info.Device, 1, &fd->Fence);
 
                 auto qResult = vkQueueSubmit(_ImVulkan_Info.Queue, 1, &submit_info, fd->Fence);
                 if (qResult != VK_SUCCESS)
@@ -589,13 +651,10 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
                     return false;
                 }
 
+                _frameRing.Submitted(slot);
+
                 pPresentInfo->waitSemaphoreCount = 1;
-                pPresentInfo->pWaitSemaphores = &_ImVulkan_Semaphores[semaphoreIndex];
-            }
-            else
-            {
-                // To make RenderMenu happy as it expects this
-                ImGui::Render();
+                pPresentInfo->pWaitSemaphores = &fd->Semaphore;
             }
         }
     }
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+// Picks a render scale (render / display size) that keeps the measured frame time near the target.
+// PI controller on the normalized frame time error with a smoothed input, a dead band for hysteresis
+// and a per frame step limit so the resolution doesn't pump. Integral only accumulates while the
+// scale isn't clamped to avoid wind up at the limits.
+// Pure component, frame times are fed by the caller and nothing here depends on Windows or graphics APIs.
+class DrsGovernor
+{
+  public:
+    struct Settings
+    {
+        double targetFrameTime = 16.667; // ms
+        float minScale = 0.5f;
+        float maxScale = 1.0f;
+        float kp = 0.08f;
+        float ki = 0.01f;
+        float deadBand = 0.04f;      // Errors smaller than this fraction of the target are ignored
+        float maxStep = 0.02f;       // Max scale change per frame
+        float smoothing = 0.15f;     // Weight of the newest frame time
+        double maxFrameTime = 250.0; // Longer frames are loading screens or hitches, ignored
+    };
+
+  private:
+    Settings _settings {};
+    float _scale = 1.0f;
+    float _integral = 0.0f;
+    double _smoothed = 0.0;
+    bool _hasSample = false;
+
+  public:
+    void Configure(const Settings& settings)
+    {
+        _settings = settings;
+
+        if (_settings.minScale > _settings.maxScale)
+            std::swap(_settings.minScale, _settings.maxScale);
+
+        _scale = std::clamp(_scale, _settings.minScale, _settings.maxScale);
+    }
+
+    const Settings& GetSettings() const { return _settings; }
+
+    void Reset()
+    {
+        _scale = _settings.maxScale;
+        _integral = 0.0f;
+        _smoothed = 0.0;
+        _hasSample = false;
+    }
+
+    // Feeds the last frame time in ms and returns the scale for the next frame
+    float Update(double frameTime)
+    {
+        if (frameTime <= 0.0 || frameTime > _settings.maxFrameTime || _settings.targetFrameTime <= 0.0)
+            return _scale;
+
+        if (!_hasSample)
+        {
+            _smoothed = frameTime;
+            _hasSample = true;
+        }
+        else
+        {
+            _smoothed += (frameTime - _smoothed) * _settings.smoothing;
+        }
+
+        // Positive when frames are too slow
+        auto error = static_cast<float>((_smoothed - _settings.targetFrameTime) / _settings.targetFrameTime);
+
+        if (std::fabs(error) < _settings.deadBand)
+        {
+            // Let the integral settle instead of pushing the scale inside the band
+            _integral *= 0.9f;
+            return _scale;
+        }
+
+        auto step = -(_settings.kp * error + _settings.ki * _integral);
+        step = std::clamp(step, -_settings.maxStep, _settings.maxStep);
+
+        auto scale = std::clamp(_scale + step, _settings.minScale, _settings.maxScale);
+
+        if (scale > _settings.minScale && scale < _settings.maxScale)
+            _integral += error;
+
+        _scale = scale;
+        return _scale;
+    }
+
+    float Scale() const { return _scale; }
+};
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "IdentifyGpu.h"
 #include "fsr4/FSR4Upgrade.h"
+#include "SnapshotCache.h"
 
 #include <proxies/Dxgi_Proxy.h>
 #include <proxies/D3d12_Proxy.h>
@@ -9,6 +10,19 @@
 
 using Microsoft::WRL::ComPtr;
 
+struct GpuSnapshot
+{
+    std::vector<GpuInformation> gpus;
+    GpuInformation primary;
+};
+
+static SnapshotCache<GpuSnapshot> gpuCache;
+
+static ComPtr<IDXGIFactory7> adapterChangeFactory = nullptr;
+static HANDLE adapterChangeEvent = nullptr;
+static HANDLE adapterChangeWait = nullptr;
+static DWORD adapterChangeCookie = 0;
+
 // Prioritize Nvidia cards that can run DLSS and are connected to a display
 void sortGpus(std::vector<GpuInformation>& gpus)
 {
@@ -53,6 +67,8 @@ std::vector<GpuInformation> IdentifyGpu::checkGpuInfo()
         return localCachedInfo;
     }
 
+    registerAdapterChangeEvent(factory.Get());
+
     UINT adapterIndex = 0;
     DXGI_ADAPTER_DESC1 adapterDesc {};
     ComPtr<IDXGIAdapter1> adapter;
@@ -409,14 +425,14 @@ void IdentifyGpu::getHardwareAdapter(IDXGIFactory* InFactory, IDXGIAdapter** InA
 
     *InAdapter = nullptr;
 
-    auto allGpus = getAllGpus();
+    const auto& allGpus = getAllGpus();
     IDXGIFactory6* factory6 = nullptr;
 
     if (InFactory->QueryInterface(IID_PPV_ARGS(&factory6)) == S_OK && factory6 != nullptr)
     {
         D3d12Proxy::Init();
 
-        for (auto gpu : allGpus)
+        for (const auto& gpu : allGpus)
         {
             if (*InAdapter == nullptr)
             {
@@ -444,17 +460,57 @@ void IdentifyGpu::getHardwareAdapter(IDXGIFactory* InFactory, IDXGIAdapter** InA
     }
 }
 
-std::vector<GpuInformation> IdentifyGpu::getAllGpus()
+static VOID CALLBACK onAdaptersChanged(PVOID lpParameter, BOOLEAN TimerOrWaitFired)
 {
-    // Static inits are thread safe
-    static std::vector<GpuInformation> cache = []() { return checkGpuInfo(); }();
-    return cache;
+    LOG_INFO("DXGI adapters changed, invalidating GPU info");
+    IdentifyGpu::invalidateCache();
 }
 
-GpuInformation IdentifyGpu::getPrimaryGpu()
+void IdentifyGpu::registerAdapterChangeEvent(IDXGIFactory6* factory)
 {
-    auto allGpus = getAllGpus();
-    return allGpus.size() > 0 ? allGpus[0] : GpuInformation {};
+    // Only once per process, the factory is kept alive to keep the registration
+    if (adapterChangeFactory != nullptr || factory == nullptr)
+        return;
+
+    if (FAILED(factory->QueryInterface(IID_PPV_ARGS(&adapterChangeFactory))))
+    {
+        LOG_DEBUG("IDXGIFactory7 is not supported, adapter changes won't be tracked");
+        adapterChangeFactory = nullptr;
+        return;
+    }
+
+    adapterChangeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+
+    if (adapterChangeEvent == nullptr ||
+        FAILED(adapterChangeFactory->RegisterAdaptersChangedEvent(adapterChangeEvent, &adapterChangeCookie)) ||
+        !RegisterWaitForSingleObject(&adapterChangeWait, adapterChangeEvent, onAdaptersChanged, nullptr, INFINITE,
+                                     WT_EXECUTEDEFAULT))
+    {
+        LOG_WARN("Can't register for adapter change events");
+    }
+}
+
+static GpuSnapshot buildSnapshot(std::vector<GpuInformation> gpus)
+{
+    GpuSnapshot snapshot {};
+    snapshot.gpus = std::move(gpus);
+
+    if (snapshot.gpus.size() > 0)
+        snapshot.primary = snapshot.gpus[0];
+
+    return snapshot;
+}
+
+void IdentifyGpu::invalidateCache() { gpuCache.Invalidate(); }
+
+const std::vector<GpuInformation>& IdentifyGpu::getAllGpus()
+{
+    return gpuCache.Get([]() { return buildSnapshot(checkGpuInfo()); }).gpus;
+}
+
+const GpuInformation& IdentifyGpu::getPrimaryGpu()
+{
+    return gpuCache.Get([]() { return buildSnapshot(checkGpuInfo()); }).primary;
 }
 
 // !!! Use the Vulkan variants only inside DLL_PROCESS_ATTACH as they provide incomplete data !!!
@@ -71,9 +71,8 @@ struct GpuInformation
 // - Opti in many spots assumes a single GPU and that all handles are coming from that gpu,
 // might need to always check if LUID of the held device matches the one provided by this class
 // before trying to use any info from here. Could also create a method to query GpuInformation based on LUID
-// - Consider adding resetCache in case primary GPU has changed somehow + some way to tell IdentifyGpu
-// which GPU is the primary one. Seems mostly useful in cases where the game would manually chose a different GPU.
-// Would require removing "static" from calls to getPrimaryGpu().
+// - Some way to tell IdentifyGpu which GPU is the primary one. Seems mostly useful in cases where the game would
+// manually chose a different GPU. Callers that keep a "static" copy of getPrimaryGpu() won't see cache invalidations.
 
 inline constexpr bool IsEqualLUID(LUID luid1, LUID luid2)
 {
@@ -83,6 +82,7 @@ inline constexpr bool IsEqualLUID(LUID luid1, LUID luid2)
 class IdentifyGpu
 {
     static std::vector<GpuInformation> checkGpuInfo();
+    static void registerAdapterChangeEvent(IDXGIFactory6* factory);
     static std::vector<GpuInformation> checkGpuInfoVulkan();
     static void queryNvapi(GpuInformation& gpuInfo);
 
@@ -91,8 +91,13 @@ class IdentifyGpu
                                    D3D_FEATURE_LEVEL requiredFeatureLevel);
 
     // Sorted by priority, the first one should be treated as the primary one
-    static std::vector<GpuInformation> getAllGpus();
-    static GpuInformation getPrimaryGpu();
+    // Cached, returned references stay valid even after the cache is invalidated
+    static const std::vector<GpuInformation>& getAllGpus();
+    static const GpuInformation& getPrimaryGpu();
+
+    // Drops the cached GPU info, next call to getAllGpus/getPrimaryGpu enumerates the adapters again.
+    // Called automatically when DXGI reports an adapter change.
+    static void invalidateCache();
     static std::vector<GpuInformation> getAllGpusVulkan();
     static GpuInformation getPrimaryGpuVulkan();
 };
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Modules callers are checked against
+enum class KnownModule : uint8_t
+{
+    Unknown,
+    GameExe,
+    OptiScaler,
+    Vulkan,
+    AmdVlk,
+    Dxgi,
+    D3D12,
+    D3D12Core,
+    Amdxc64,
+};
+
+// Case insensitive match of a module file name, without path
+inline KnownModule ClassifyModuleName(std::string_view fileName)
+{
+    struct KnownName
+    {
+        std::string_view name;
+        KnownModule id;
+    };
+
+    static constexpr KnownName names[] = {
+        { "vulkan-1.dll", KnownModule::Vulkan },
+        { "amdvlk64.dll", KnownModule::AmdVlk },
+        { "dxgi.dll", KnownModule::Dxgi },
+        { "d3d12.dll", KnownModule::D3D12 },
+        { "d3d12core.dll", KnownModule::D3D12Core },
+        { "amdxc64.dll", KnownModule::Amdxc64 },
+    };
+
+    for (const auto& known : names)
+    {
+        if (known.name.size() != fileName.size())
+            continue;
+
+        bool match = true;
+
+        for (size_t i = 0; i < fileName.size() && match; i++)
+        {
+            auto c = fileName[i];
+
+            if (c >= 'A' && c <= 'Z')
+                c = c - 'A' + 'a';
+
+            match = c == known.name[i];
+        }
+
+        if (match)
+            return known.id;
+    }
+
+    return KnownModule::Unknown;
+}
+
+struct ModuleRange
+{
+    uintptr_t base = 0;
+    uintptr_t end = 0;
+    void* handle = nullptr;
+    KnownModule id = KnownModule::Unknown;
+    std::string name;
+};
+
+// Address ranges of loaded modules sorted by base address.
+// Built once per module change and only read afterwards, so lookups don't need a lock.
+// Doesn't depend on any Windows API, ranges are collected by the caller.
+class ModuleRangeTable
+{
+    std::vector<ModuleRange> _ranges;
+
+  public:
+    ModuleRangeTable() = default;
+
+    explicit ModuleRangeTable(std::vector<ModuleRange> ranges) : _ranges(std::move(ranges))
+    {
+        std::sort(_ranges.begin(), _ranges.end(),
+                  [](const ModuleRange& a, const ModuleRange& b) { return a.base < b.base; });
+    }
+
+    // Returns the module containing the address, nullptr when none does
+    const ModuleRange* Find(uintptr_t address) const
+    {
+        auto it = std::upper_bound(_ranges.begin(), _ranges.end(), address,
+                                   [](uintptr_t value, const ModuleRange& range) { return value < range.base; });
+
+        if (it == _ranges.begin())
+            return nullptr;
+
+        --it;
+
+        return address < it->end ? &*it : nullptr;
+    }
+
+    size_t Size() const { return _ranges.size(); }
+};
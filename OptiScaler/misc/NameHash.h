@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// FNV-1a hash of an export name with its length, computed at compile time for the names we look for.
+// Matching stops as soon as the name gets longer than the target, so unrelated long names are cheap to reject.
+struct NameHash
+{
+    uint64_t hash;
+    size_t length;
+    const char* name;
+
+    static constexpr uint64_t Offset = 0xcbf29ce484222325ull;
+    static constexpr uint64_t Prime = 0x100000001b3ull;
+
+    constexpr NameHash(const char* str) : hash(Offset), length(0), name(str)
+    {
+        while (str[length] != '\0')
+        {
+            hash ^= static_cast<uint8_t>(str[length]);
+            hash *= Prime;
+            length++;
+        }
+    }
+
+    bool Matches(const char* str) const
+    {
+        if (str == nullptr)
+            return false;
+
+        uint64_t h = Offset;
+        size_t i = 0;
+
+        for (; str[i] != '\0'; i++)
+        {
+            if (i >= length)
+                return false;
+
+            h ^= static_cast<uint8_t>(str[i]);
+            h *= Prime;
+        }
+
+        // Confirm in case of a collision
+        return i == length && h == hash && std::memcmp(str, name, length) == 0;
+    }
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <ankerl/unordered_dense.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+// Descriptions of resources keyed by their pointer, filled the first time a resource is seen.
+// Entries must be invalidated when a resource is destroyed, otherwise a new resource at the same address
+// would get the old description. Every invalidation increases the generation, a lookup which queried the
+// resource while an invalidation happened doesn't store its result, so a released pointer can't be put back.
+// Doesn't depend on D3D12, the query is passed in by the caller:
+//   Desc query(Resource* resource)
+template <typename Resource, typename Desc> class ResourceDescCache
+{
+    mutable std::shared_mutex _mutex;
+    ankerl::unordered_dense::map<Resource*, Desc> _descs;
+    std::atomic<uint64_t> _generation = 0;
+    std::atomic<bool> _enabled = false;
+
+  public:
+    // Only enable while invalidations are guaranteed, disabling clears the cache
+    void SetEnabled(bool enabled)
+    {
+        std::unique_lock lock(_mutex);
+
+        _enabled.store(enabled, std::memory_order_release);
+        _generation.fetch_add(1, std::memory_order_acq_rel);
+        _descs.clear();
+    }
+
+    bool IsEnabled() const { return _enabled.load(std::memory_order_acquire); }
+
+    template <typename Query> Desc Get(Resource* resource, Query&& query)
+    {
+        if (!_enabled.load(std::memory_order_acquire))
+            return query(resource);
+
+        {
+            std::shared_lock lock(_mutex);
+
+            if (auto it = _descs.find(resource); it != _descs.end())
+                return it->second;
+        }
+
+        auto generation = _generation.load(std::memory_order_acquire);
+        auto desc = query(resource);
+
+        std::unique_lock lock(_mutex);
+
+        if (_enabled.load(std::memory_order_relaxed) && _generation.load(std::memory_order_relaxed) == generation)
+            _descs.try_emplace(resource, desc);
+
+        return desc;
+    }
+
+    void Invalidate(Resource* resource)
+    {
+        if (!_enabled.load(std::memory_order_acquire))
+            return;
+
+        std::unique_lock lock(_mutex);
+
+        _generation.fetch_add(1, std::memory_order_acq_rel);
+        _descs.erase(resource);
+    }
+
+    bool Contains(Resource* resource) const
+    {
+        std::shared_lock lock(_mutex);
+        return _descs.contains(resource);
+    }
+
+    uint64_t Generation() const { return _generation.load(std::memory_order_acquire); }
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Holds an immutable snapshot that is built once and read without locking afterwards.
+// Invalidate() only marks the snapshot as stale, the next Get() builds a new one.
+// Old snapshots are kept alive for the lifetime of the cache so references handed out never dangle.
+// Doesn't depend on any Windows API, the builder is passed in by the caller.
+template <typename T> class SnapshotCache
+{
+    std::atomic<const T*> _current = nullptr;
+    std::atomic<bool> _stale = false;
+    std::atomic<uint32_t> _generation = 0;
+
+    std::mutex _buildMutex;
+    std::vector<std::unique_ptr<T>> _snapshots;
+
+  public:
+    template <typename Builder> const T& Get(Builder&& build)
+    {
+        auto current = _current.load(std::memory_order_acquire);
+
+        if (current != nullptr && !_stale.load(std::memory_order_acquire)) [[likely]]
+            return *current;
+
+        std::lock_guard<std::mutex> lock(_buildMutex);
+
+        // Someone else might have rebuilt it while we were waiting
+        current = _current.load(std::memory_order_relaxed);
+        if (current != nullptr && !_stale.load(std::memory_order_acquire))
+            return *current;
+
+        // Cleared before building so an invalidation that happens during the build isn't lost
+        _stale.store(false, std::memory_order_release);
+
+        auto snapshot = std::make_unique<T>(build());
+        current = snapshot.get();
+        _snapshots.push_back(std::move(snapshot));
+
+        _current.store(current, std::memory_order_release);
+        _generation.fetch_add(1, std::memory_order_acq_rel);
+
+        return *current;
+    }
+
+    void Invalidate() { _stale.store(true, std::memory_order_release); }
+
+    bool IsStale() const
+    {
+        return _current.load(std::memory_order_acquire) == nullptr || _stale.load(std::memory_order_acquire);
+    }
+
+    // Increases every time a new snapshot is published
+    uint32_t Generation() const { return _generation.load(std::memory_order_acquire); }
+};
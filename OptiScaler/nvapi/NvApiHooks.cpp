@@ -10,6 +10,33 @@
 #include <detours/detours.h>
 #include <misc/IdentifyGpu.h>
 
+#include <shared_mutex>
+
+// Results of pass-through queries, including nullptr for unsupported ids
+static ankerl::unordered_dense::map<unsigned int, void*> _queryCache;
+static std::shared_mutex _queryCacheMutex;
+
+// Resolved once instead of looking up the names on every query
+struct HookedInterfaceIds
+{
+    unsigned int flipMetering = 0xF3148C42;
+    unsigned int getArchInfo = GET_ID(NvAPI_GPU_GetArchInfo);
+    unsigned int drsGetSetting = GET_ID(NvAPI_DRS_GetSetting);
+
+    unsigned int reflex[7] = { GET_ID(NvAPI_D3D_SetSleepMode),
+                               GET_ID(NvAPI_D3D_Sleep),
+                               GET_ID(NvAPI_D3D_GetLatency),
+                               GET_ID(NvAPI_D3D_SetLatencyMarker),
+                               GET_ID(NvAPI_D3D12_SetAsyncFrameMarker),
+                               GET_ID(NvAPI_Vulkan_SetLatencyMarker),
+                               GET_ID(NvAPI_Vulkan_SetSleepMode) };
+
+    bool IsReflex(unsigned int id) const
+    {
+        return std::find(std::begin(reflex), std::end(reflex), id) != std::end(reflex);
+    }
+};
+
 NvAPI_Status __stdcall NvApiHooks::hkNvAPI_GPU_GetArchInfo(NvPhysicalGpuHandle hPhysicalGpu,
                                                            NV_GPU_ARCH_INFO* pGpuArchInfo)
 {
@@ -90,19 +117,17 @@ void* __stdcall NvApiHooks::hkNvAPI_QueryInterface(unsigned int InterfaceId)
             return nullptr;
 
     static auto primaryGpu = IdentifyGpu::getPrimaryGpu();
+    static const HookedInterfaceIds ids {};
 
-    // Disable flip metering
-    if (InterfaceId == 0xF3148C42 &&
+    // Disable flip metering, not cached as the config can change at runtime
+    if (InterfaceId == ids.flipMetering &&
         Config::Instance()->DisableFlipMetering.value_or(primaryGpu.vendorId != VendorId::Nvidia))
     {
         LOG_INFO("FlipMetering is disabled!");
         return nullptr;
     }
 
-    if (InterfaceId == GET_ID(NvAPI_D3D_SetSleepMode) || InterfaceId == GET_ID(NvAPI_D3D_Sleep) ||
-        InterfaceId == GET_ID(NvAPI_D3D_GetLatency) || InterfaceId == GET_ID(NvAPI_D3D_SetLatencyMarker) ||
-        InterfaceId == GET_ID(NvAPI_D3D12_SetAsyncFrameMarker) ||
-        InterfaceId == GET_ID(NvAPI_Vulkan_SetLatencyMarker) || InterfaceId == GET_ID(NvAPI_Vulkan_SetSleepMode))
+    if (ids.IsReflex(InterfaceId))
     {
         // LOG_DEBUG("counter: {}, hookReflex()", qiCounter);
         ReflexHooks::hookReflex(o_NvAPI_QueryInterface);
@@ -111,25 +136,34 @@ void* __stdcall NvApiHooks::hkNvAPI_QueryInterface(unsigned int InterfaceId)
 
     ReflexHooks::hookReflex(o_NvAPI_QueryInterface);
 
-    const auto functionPointer = o_NvAPI_QueryInterface(InterfaceId);
+    {
+        std::shared_lock<std::shared_mutex> lock(_queryCacheMutex);
+
+        auto it = _queryCache.find(InterfaceId);
+        if (it != _queryCache.end())
+            return it->second;
+    }
+
+    auto functionPointer = o_NvAPI_QueryInterface(InterfaceId);
 
     if (functionPointer)
     {
-        if (InterfaceId == GET_ID(NvAPI_GPU_GetArchInfo))
+        if (InterfaceId == ids.getArchInfo)
         {
             o_NvAPI_GPU_GetArchInfo = reinterpret_cast<decltype(&NvAPI_GPU_GetArchInfo)>(functionPointer);
-            return &hkNvAPI_GPU_GetArchInfo;
+            functionPointer = &hkNvAPI_GPU_GetArchInfo;
         }
-        if (InterfaceId == GET_ID(NvAPI_DRS_GetSetting))
+        else if (InterfaceId == ids.drsGetSetting)
         {
             o_NvAPI_DRS_GetSetting = reinterpret_cast<decltype(&NvAPI_DRS_GetSetting)>(functionPointer);
-            return &hkNvAPI_DRS_GetSetting;
+            functionPointer = &hkNvAPI_DRS_GetSetting;
         }
     }
 
     // LOG_DEBUG("counter: {} functionPointer: {:X}", qiCounter, (size_t)functionPointer);
 
-    return functionPointer;
+    std::unique_lock<std::shared_mutex> lock(_queryCacheMutex);
+    return _queryCache.try_emplace(InterfaceId, functionPointer).first->second;
 }
 
 // Requires HMODULE to make sure nvapi is loaded before calling this function
@@ -175,4 +209,7 @@ void NvApiHooks::Unhook()
     }
 
     DetourTransactionCommit();
+
+    std::unique_lock<std::shared_mutex> lock(_queryCacheMutex);
+    _queryCache.clear();
 }
@@ -3,20 +3,43 @@
 
 #include <nvapi_interface.h>
 
+// names from: https://github.com/SveSop/nvapi_standalone/blob/master/dlls/nvapi/nvapi.c
+static const NvApiInterfaceEntry additional_interface_table[] = { { 0x33c7358c, "NvAPI_Diag_ReportCallStart" },
+                                                                  { 0x593e8644, "NvAPI_Diag_ReportCallReturn" },
+                                                                  { 0xe9b009b9, "NvAPI_Unknown_1" },
+                                                                  { 0x57f7caac, "NvAPI_SK_1" },
+                                                                  { 0x11104158, "NvAPI_SK_2" },
+                                                                  { 0xe3795199, "NvAPI_SK_3" },
+                                                                  { 0xdf0dfcdd, "NvAPI_SK_4" },
+                                                                  { 0x932ac8fb, "NvAPI_SK_5" } };
+
 NvApiTypes::NvApiTypes()
 {
+    sortedById.reserve(std::size(nvapi_interface_table) + std::size(additional_interface_table));
+
     for (const auto& entry : nvapi_interface_table)
     {
         lookupTable[entry.func] = entry.id;
+        sortedById.push_back({ entry.id, entry.func });
+    }
+
+    for (const auto& entry : additional_interface_table)
+    {
+        lookupTable.try_emplace(entry.func, entry.id);
+        sortedById.push_back(entry);
     }
+
+    std::sort(sortedById.begin(), sortedById.end(),
+              [](const NvApiInterfaceEntry& a, const NvApiInterfaceEntry& b) { return a.id < b.id; });
 }
+
 NvApiTypes& NvApiTypes::Instance()
 {
     static NvApiTypes instance;
     return instance;
 }
 
-unsigned int NvApiTypes::getId(const std::string& name) const
+unsigned int NvApiTypes::getId(std::string_view name) const
 {
     auto it = lookupTable.find(name);
     if (it != lookupTable.end())
@@ -26,3 +49,14 @@ unsigned int NvApiTypes::getId(const std::string& name) const
     LOG_TRACE("Not a known nvapi interface");
     return 0;
 }
+
+const char* NvApiTypes::getName(unsigned int id) const
+{
+    auto it = std::lower_bound(sortedById.begin(), sortedById.end(), id,
+                               [](const NvApiInterfaceEntry& entry, unsigned int value) { return entry.id < value; });
+
+    if (it != sortedById.end() && it->id == id)
+        return it->func;
+
+    return nullptr;
+}
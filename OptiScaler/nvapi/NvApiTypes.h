@@ -4,20 +4,39 @@
 #include <dxgi.h>
 #include <d3d12.h>
 #include <nvapi.h>
+#include <string_view>
 
 #define GET_ID(name) NvApiTypes::Instance().getId(#name)
 #define GET_INTERFACE(name, queryInterface) reinterpret_cast<decltype(&name)>(queryInterface(GET_ID(name)))
 
 typedef void*(__stdcall* PFN_NvApi_QueryInterface)(unsigned int InterfaceId);
 
+struct NvApiInterfaceEntry
+{
+    unsigned int id;
+    const char* func;
+};
+
 // Separate to break up a circular dependency
 class NvApiTypes
 {
-    std::unordered_map<std::string, unsigned int> lookupTable;
+    struct StringHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view str) const { return std::hash<std::string_view> {}(str); }
+    };
+
+    std::unordered_map<std::string, unsigned int, StringHash, std::equal_to<>> lookupTable;
+
+    // nvapi_interface_table + additional entries, sorted by id for binary search
+    std::vector<NvApiInterfaceEntry> sortedById;
 
     NvApiTypes();
 
   public:
     static NvApiTypes& Instance();
-    unsigned int getId(const std::string& name) const;
+    unsigned int getId(std::string_view name) const;
+
+    // Returns nullptr for unknown ids
+    const char* getName(unsigned int id) const;
 };
@@ -1,7 +1,6 @@
 #include "pch.h"
 
 #include "proxies/FfxApi_Proxy.h"
-#include <unordered_map>
 
 #include "fakenvapi.h"
 #include "NvApiTypes.h"
@@ -9,11 +8,10 @@
 #include "fakenvapi/al2_proxy.h"
 #include "fakenvapi/fn_vulkan_hooks.h"
 
-#define nvapi_interface_table nvapi_interface_table_extern
-#include <nvapi_interface.h>
-#undef nvapi_interface_table
+#include <shared_mutex>
 
-std::unordered_map<NvU32, void*> fakenvapi::idToFuncMapping;
+ankerl::unordered_dense::map<NvU32, void*> fakenvapi::idToFuncMapping;
+static std::shared_mutex idToFuncMappingMutex;
 
 void fakenvapi::init()
 {
@@ -52,45 +50,33 @@ void fakenvapi::deinit()
     LowLatencyCtx::shutdown();
 }
 
-// names from: https://github.com/SveSop/nvapi_standalone/blob/master/dlls/nvapi/nvapi.c
-static NVAPI_INTERFACE_TABLE additional_interface_table[] = { { "NvAPI_Diag_ReportCallStart", 0x33c7358c },
-                                                              { "NvAPI_Diag_ReportCallReturn", 0x593e8644 },
-                                                              { "NvAPI_Unknown_1", 0xe9b009b9 },
-                                                              { "NvAPI_SK_1", 0x57f7caac },
-                                                              { "NvAPI_SK_2", 0x11104158 },
-                                                              { "NvAPI_SK_3", 0xe3795199 },
-                                                              { "NvAPI_SK_4", 0xdf0dfcdd },
-                                                              { "NvAPI_SK_5", 0x932ac8fb } };
-
 extern "C" __declspec(dllexport) void* nvapi_QueryInterface(NvU32 id) { return fakenvapi::queryInterface(id); }
 
 void* __cdecl fakenvapi::queryInterface(NvU32 id)
 {
-    auto entry = idToFuncMapping.find(id);
-    if (entry != idToFuncMapping.end())
-        return entry->second;
-
-    constexpr auto original_size = sizeof(nvapi_interface_table_extern) / sizeof(nvapi_interface_table_extern[0]);
-    constexpr auto additional_size = sizeof(additional_interface_table) / sizeof(additional_interface_table[0]);
+    {
+        std::shared_lock<std::shared_mutex> lock(idToFuncMappingMutex);
 
-    constexpr auto total_size = original_size + additional_size;
+        auto entry = idToFuncMapping.find(id);
+        if (entry != idToFuncMapping.end())
+            return entry->second;
+    }
 
-    struct NVAPI_INTERFACE_TABLE extended_interface_table[total_size] {};
-    memcpy(extended_interface_table, nvapi_interface_table_extern,
-           sizeof(nvapi_interface_table_extern)); // copy original table
+    // Unknown ids are cached as nullptr too
+    auto function = resolveInterface(id);
 
-    for (unsigned int i = 0; i < additional_size; i++)
-    {
-        extended_interface_table[original_size + i] = additional_interface_table[i];
-    }
+    std::unique_lock<std::shared_mutex> lock(idToFuncMappingMutex);
+    return idToFuncMapping.try_emplace(id, function).first->second;
+}
 
-    auto it = std::find_if(std::begin(extended_interface_table), std::end(extended_interface_table),
-                           [id](const auto& item) { return item.id == id; });
+void* fakenvapi::resolveInterface(NvU32 id)
+{
+    auto name = NvApiTypes::Instance().getName(id);
 
-    if (it == std::end(extended_interface_table))
+    if (name == nullptr)
     {
         LOG_DEBUG("NvAPI_QueryInterface (0x{:x}): Unknown interface ID", id);
-        return idToFuncMapping.insert({ id, nullptr }).first->second;
+        return nullptr;
     }
 
     INSERT_AND_RETURN_WHEN_EQUALS(NvAPI_Initialize)
@@ -168,9 +154,8 @@ void* __cdecl fakenvapi::queryInterface(NvU32 id)
     INSERT_AND_RETURN_WHEN_EQUALS(NvAPI_SK_5)
     INSERT_AND_RETURN_WHEN_EQUALS(NvAPI_Unload)
 
-    LOG_DEBUG("{}: not implemented, placeholder given", it->func);
-    return idToFuncMapping.insert({ id, (void*) placeholder }).first->second;
-    // return registry.insert({ id, nullptr }).first->second;
+    LOG_DEBUG("{}: not implemented, placeholder given", name);
+    return (void*) placeholder;
 }
 
 // Inform AntiLag 2 when present of interpolated frames starts
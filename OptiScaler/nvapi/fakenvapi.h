@@ -2,7 +2,7 @@
 
 #include <dxgi.h>
 #include <d3d12.h>
-#include <unordered_map>
+#include <ankerl/unordered_dense.h>
 #include "fakenvapi/fn_util.h"
 
 class fakenvapi
@@ -19,7 +19,10 @@ class fakenvapi
     inline static LowLatencyMode _lowLatencyMode = LowLatencyMode::LatencyFlex;
     inline static HMODULE _dllForNvidia = nullptr;
 
-    static std::unordered_map<NvU32, void*> idToFuncMapping;
+    // Filled lazily by queryInterface, unknown ids map to nullptr
+    static ankerl::unordered_dense::map<NvU32, void*> idToFuncMapping;
+
+    static void* resolveInterface(NvU32 id);
 
     static NvAPI_Status __cdecl placeholder()
     {
@@ -17,8 +17,8 @@ enum class LowLatencyMode
 void tonvss(NvAPI_ShortString nvss, std::string str);
 
 #define INSERT_AND_RETURN_WHEN_EQUALS(method)                                                                          \
-    if (std::string(it->func) == #method)                                                                              \
-        return fakenvapi::idToFuncMapping.insert({ id, (void*) nvapi_calls::method }).first->second;
+    if (strcmp(name, #method) == 0)                                                                                    \
+        return (void*) nvapi_calls::method;
 
 static inline uint64_t get_timestamp()
 {
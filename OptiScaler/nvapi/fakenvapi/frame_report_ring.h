@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Helpers for the frame report ring, reports are stored at frameID % size
+// Only depend on the report having a frameID member so they can be used without any Windows headers
+
+// Index of the report with the lowest frameID
+template <typename Report, size_t N> size_t ring_oldest_index(const Report (&ring)[N])
+{
+    size_t min_idx = 0;
+    uint64_t min_id = ring[0].frameID;
+
+    for (size_t i = 1; i < N; i++)
+    {
+        if (ring[i].frameID < min_id)
+        {
+            min_id = ring[i].frameID;
+            min_idx = i;
+        }
+    }
+
+    return min_idx;
+}
+
+// Index of the report with the highest frameID, N when the ring is empty
+template <typename Report, size_t N> size_t ring_newest_index(const Report (&ring)[N])
+{
+    size_t max_idx = N;
+    uint64_t max_id = 0;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        if (ring[i].frameID > max_id)
+        {
+            max_id = ring[i].frameID;
+            max_idx = i;
+        }
+    }
+
+    return max_idx;
+}
+
+// Copies up to max_count of the newest reports with frameID > after_frame_id, oldest first
+// The newest report is skipped as markers of the current frame are still being added to it
+// Returns the number of reports copied
+template <typename Report, size_t N>
+size_t ring_copy_reports_since(const Report (&ring)[N], uint64_t after_frame_id, Report* out, size_t max_count)
+{
+    if (out == nullptr || max_count == 0)
+        return 0;
+
+    auto newest_idx = ring_newest_index(ring);
+
+    if (newest_idx == N)
+        return 0;
+
+    auto newest_id = ring[newest_idx].frameID;
+
+    if (newest_id <= after_frame_id + 1)
+        return 0;
+
+    // Last completed frame and how far back we can go
+    uint64_t last_id = newest_id - 1;
+    uint64_t available = last_id - after_frame_id;
+
+    if (available > N - 1)
+        available = N - 1;
+
+    if (available > max_count)
+        available = max_count;
+
+    size_t count = 0;
+
+    for (uint64_t id = last_id - available + 1; id <= last_id; id++)
+    {
+        auto& report = ring[id % N];
+
+        // Frames without any markers don't have a report
+        if (report.frameID != id)
+            continue;
+
+        out[count++] = report;
+    }
+
+    return count;
+}
@@ -6,6 +6,7 @@
 #include <d3d12.h>
 
 #include "fn_util.h"
+#include "frame_report_ring.h"
 #include <optional>
 
 #define FRAME_REPORTS_BUFFER_SIZE 70
@@ -73,6 +74,12 @@ class LowLatency
     bool get_low_latency_context(void** low_latency_context, LowLatencyMode* low_latency_tech);
     bool set_low_latency_context(void* low_latency_context, LowLatencyMode low_latency_tech);
 
+    // Newest completed reports after after_frame_id without copying the whole ring, oldest first
+    size_t get_reports_since(uint64_t after_frame_id, FrameReport* reports, size_t max_count) const
+    {
+        return ring_copy_reports_since(frame_reports, after_frame_id, reports, max_count);
+    }
+
     // D3D
     NvAPI_Status Sleep(IUnknown* pDevice);
     NvAPI_Status SetSleepMode(IUnknown* pDevice, NV_SET_SLEEP_MODE_PARAMS* pSetSleepModeParams);
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "ll_latencyflex.h"
 #include "config.h"
+#include <State.h>
 #include <nvapi/fakenvapi/log.h>
 
 void LatencyFlex::lfx_sleep(uint64_t reflex_frame_id)
@@ -13,20 +14,30 @@ void LatencyFlex::lfx_sleep(uint64_t reflex_frame_id)
     static LFXMode previous_lfx_mode = (LFXMode) Config::Instance()->FN_LatencyFlexMode.value_or_default();
     LFXMode lfx_mode = (LFXMode) Config::Instance()->FN_LatencyFlexMode.value_or_default();
 
-    if (previous_lfx_mode != lfx_mode)
+    bool gpu_feedback = use_gpu_feedback();
+    static bool previous_gpu_feedback = gpu_feedback;
+
+    // Frame ends come from another source after a feedback change
+    if (previous_lfx_mode != lfx_mode || previous_gpu_feedback != gpu_feedback)
         needs_reset = true;
 
     previous_lfx_mode = lfx_mode;
+    previous_gpu_feedback = gpu_feedback;
 
     if (needs_reset)
     {
         LOG_INFO("LFX Reset");
-        eepy(200000000ULL);
-        frame_id = 1;
         needs_reset = false;
 
+        // Ends of frames still in flight are dropped by the epoch instead of sleeping until they are done
+        mutex.lock();
+        frame_id = 1;
+        reset_epoch++;
+
         if (ctx)
             ctx->Reset();
+
+        mutex.unlock();
     }
 
     uint64_t current_timestamp = get_timestamp();
@@ -35,7 +46,7 @@ void LatencyFlex::lfx_sleep(uint64_t reflex_frame_id)
     // Set FPS Limiter
     ctx->target_frame_time = 1000 * minimum_interval_us;
 
-    if (lfx_mode == LFXMode::Conservative)
+    if (lfx_mode == LFXMode::Conservative && !gpu_feedback)
         lfx_end_frame(INVALID_ID); // it should not be using this frame id in the conservative mode
 
     mutex.lock();
@@ -98,8 +109,236 @@ void LatencyFlex::lfx_end_frame(uint64_t reflex_frame_id)
                         current_timestamp);
 }
 
+bool LatencyFlex::use_gpu_feedback()
+{
+    if (!is_d3d12 || !present_markers || feedback_failed ||
+        !Config::Instance()->FN_LatencyFlexGpuFeedback.value_or_default())
+    {
+        return false;
+    }
+
+    auto queue = State::Instance().currentCommandQueue;
+
+    if (queue == nullptr)
+        return false;
+
+    std::scoped_lock lock(setup_mutex);
+
+    if (queue == feedback_queue && gpu_fence != nullptr)
+        return true;
+
+    ID3D12Device* device = nullptr;
+
+    if (queue->GetDevice(IID_PPV_ARGS(&device)) != S_OK)
+    {
+        LOG_ERROR("LatencyFlex GPU feedback: can't get the device of the presenting queue");
+        feedback_failed = true;
+        return false;
+    }
+
+    // Fence can be signaled on any queue of its device
+    if (gpu_fence != nullptr && device == fence_device)
+    {
+        feedback_queue = queue;
+        device->Release();
+        return true;
+    }
+
+    stop_gpu_feedback();
+
+    auto result = start_gpu_feedback(device);
+    device->Release();
+
+    if (result)
+        feedback_queue = queue;
+
+    return result;
+}
+
+bool LatencyFlex::start_gpu_feedback(ID3D12Device* device)
+{
+    if (device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&gpu_fence)) != S_OK)
+    {
+        LOG_ERROR("LatencyFlex GPU feedback: CreateFence failed");
+        gpu_fence = nullptr;
+        feedback_failed = true;
+        return false;
+    }
+
+    gpu_fence_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+
+    if (gpu_fence_event == nullptr)
+    {
+        LOG_ERROR("LatencyFlex GPU feedback: CreateEvent failed");
+        gpu_fence->Release();
+        gpu_fence = nullptr;
+        feedback_failed = true;
+        return false;
+    }
+
+    fence_device = device;
+    gpu_fence_value = 0;
+    stop_feedback = false;
+    feedback_thread = std::thread(&LatencyFlex::feedback_loop, this);
+
+    LOG_INFO("LatencyFlex GPU feedback started");
+    return true;
+}
+
+// setup_mutex must be held
+void LatencyFlex::stop_gpu_feedback()
+{
+    {
+        std::scoped_lock lock(feedback_mutex);
+        stop_feedback = true;
+        pending_frames.clear();
+    }
+
+    feedback_cv.notify_all();
+
+    if (feedback_thread.joinable())
+        feedback_thread.join();
+
+    if (gpu_fence != nullptr)
+    {
+        gpu_fence->Release();
+        gpu_fence = nullptr;
+    }
+
+    if (gpu_fence_event != nullptr)
+    {
+        CloseHandle(gpu_fence_event);
+        gpu_fence_event = nullptr;
+    }
+
+    fence_device = nullptr;
+    feedback_queue = nullptr;
+}
+
+// Called on SIMULATION_START after the frame began, by lfx_sleep on the marker or by the sleep call before it
+void LatencyFlex::map_frame_id(uint64_t reflex_frame_id)
+{
+    if (reflex_frame_id == INVALID_ID || !is_enabled())
+        return;
+
+    std::scoped_lock lock(mutex);
+
+    auto& mapping = frame_id_map[reflex_frame_id % frame_id_map.size()];
+    mapping.reflex_id = reflex_frame_id;
+    mapping.lfx_id = this->frame_id;
+    mapping.epoch = reset_epoch;
+}
+
+void LatencyFlex::signal_frame_end(uint64_t reflex_frame_id)
+{
+    PendingFrame frame {};
+
+    mutex.lock();
+    frame.epoch = reset_epoch;
+
+    if ((LFXMode) Config::Instance()->FN_LatencyFlexMode.value_or_default() == LFXMode::ReflexIDs)
+    {
+        frame.frame_id = reflex_frame_id;
+    }
+    else
+    {
+        // Current frame_id might already belong to the next frame, use the one recorded when this frame began
+        const auto& mapping = frame_id_map[reflex_frame_id % frame_id_map.size()];
+
+        if (reflex_frame_id == INVALID_ID || mapping.reflex_id != reflex_frame_id || mapping.epoch != reset_epoch)
+        {
+            mutex.unlock();
+            return;
+        }
+
+        frame.frame_id = mapping.lfx_id;
+    }
+
+    mutex.unlock();
+
+    std::scoped_lock setup_lock(setup_mutex);
+
+    if (gpu_fence == nullptr || feedback_queue == nullptr)
+        return;
+
+    std::scoped_lock lock(feedback_mutex);
+
+    // GPU is too far behind, frame is left without an end like a dropped one
+    if (pending_frames.size() >= max_pending_frames)
+        return;
+
+    frame.fence_value = ++gpu_fence_value;
+
+    if (auto hr = feedback_queue->Signal(gpu_fence, frame.fence_value); hr != S_OK)
+    {
+        LOG_ERROR("LatencyFlex GPU feedback: Signal failed: {:X}", (UINT) hr);
+        return;
+    }
+
+    pending_frames.push_back(frame);
+    feedback_cv.notify_one();
+}
+
+void LatencyFlex::feedback_loop()
+{
+    while (true)
+    {
+        PendingFrame frame {};
+
+        {
+            std::unique_lock lock(feedback_mutex);
+            feedback_cv.wait(lock, [this] { return stop_feedback || !pending_frames.empty(); });
+
+            if (stop_feedback)
+                return;
+
+            frame = pending_frames.front();
+        }
+
+        if (gpu_fence->GetCompletedValue() < frame.fence_value &&
+            gpu_fence->SetEventOnCompletion(frame.fence_value, gpu_fence_event) == S_OK)
+        {
+            // Wait in slices so deinit isn't blocked by a hung GPU
+            while (WaitForSingleObject(gpu_fence_event, 100) == WAIT_TIMEOUT)
+            {
+                if (stop_feedback)
+                    return;
+            }
+        }
+
+        auto timestamp = get_timestamp();
+
+        {
+            std::scoped_lock lock(feedback_mutex);
+
+            if (!pending_frames.empty())
+                pending_frames.pop_front();
+        }
+
+        mutex.lock();
+
+        // Frames from before a reset would be matched against the new context
+        if (ctx && frame.epoch == reset_epoch)
+            ctx->EndFrame(frame.frame_id, timestamp, &latency, &frame_time);
+
+        mutex.unlock();
+
+        LOG_TRACE_FAKENVAPI("LFX GPU latency: {}, frame_time: {}, timestamp: {}", latency, frame_time, timestamp);
+    }
+}
+
 bool LatencyFlex::init(IUnknown* pDevice)
 {
+    // Vulkan passes a null device, GPU feedback needs a D3D12 presenting queue
+    if (pDevice)
+    {
+        ID3D12Device* dx12_pDevice = nullptr;
+        is_d3d12 = pDevice->QueryInterface(IID_PPV_ARGS(&dx12_pDevice)) == S_OK;
+
+        if (dx12_pDevice)
+            dx12_pDevice->Release();
+    }
+
     if (!ctx)
     {
         ctx = new lfx::LatencyFleX();
@@ -123,6 +362,11 @@ void LatencyFlex::deinit()
 {
     deinit_mutex.lock();
 
+    {
+        std::scoped_lock lock(setup_mutex);
+        stop_gpu_feedback();
+    }
+
     if (ctx)
     {
         delete ctx;
@@ -177,11 +421,24 @@ void LatencyFlex::set_marker(IUnknown* pDevice, MarkerParams* marker_params)
 
         if (current_call_spot == CallSpot::SimulationStart)
             lfx_sleep(marker_params->frame_id);
+
+        map_frame_id(marker_params->frame_id);
         break;
 
     case MarkerType::RENDERSUBMIT_END:
-        if ((LFXMode) Config::Instance()->FN_LatencyFlexMode.value_or_default() != LFXMode::Conservative)
+        if ((LFXMode) Config::Instance()->FN_LatencyFlexMode.value_or_default() != LFXMode::Conservative &&
+            !use_gpu_feedback())
+        {
             lfx_end_frame(marker_params->frame_id);
+        }
+        break;
+
+    case MarkerType::PRESENT_START:
+        present_markers = true;
+
+        // Frame is done when the presenting queue gets past the game's rendering
+        if (use_gpu_feedback())
+            signal_frame_end(marker_params->frame_id);
         break;
     }
 };
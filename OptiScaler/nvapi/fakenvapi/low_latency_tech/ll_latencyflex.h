@@ -3,6 +3,12 @@
 #include "low_latency_tech.h"
 #include <latencyflex.h>
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
 class LatencyFlex : public virtual LowLatencyTech
 {
   private:
@@ -22,9 +28,52 @@ class LatencyFlex : public virtual LowLatencyTech
     uint64_t target = 0;
     uint64_t frame_id = 0;
     bool needs_reset = false;
+    uint64_t reset_epoch = 0;
+
+    // GPU completion feedback, frames end when the presenting queue reaches their fence value
+    struct PendingFrame
+    {
+        uint64_t frame_id;
+        uint64_t fence_value;
+        uint64_t epoch;
+    };
+
+    // Reflex marker ids of recently begun frames with their LFX ids, the render thread can present a frame
+    // after the next one already began
+    struct FrameIdMapping
+    {
+        uint64_t reflex_id = INVALID_ID;
+        uint64_t lfx_id = 0;
+        uint64_t epoch = 0;
+    };
+
+    std::array<FrameIdMapping, 16> frame_id_map {};
+
+    bool is_d3d12 = false;
+    std::atomic<bool> present_markers = false;
+    std::mutex setup_mutex;    // feedback_queue, fence_device, gpu_fence lifetime
+    std::mutex feedback_mutex; // pending_frames, gpu_fence_value
+    std::condition_variable feedback_cv;
+    std::deque<PendingFrame> pending_frames;
+    std::thread feedback_thread;
+    std::atomic<bool> stop_feedback = false;
+    ID3D12CommandQueue* feedback_queue = nullptr;
+    ID3D12Device* fence_device = nullptr; // Only compared, not referenced
+    ID3D12Fence* gpu_fence = nullptr;
+    HANDLE gpu_fence_event = nullptr;
+    uint64_t gpu_fence_value = 0;
+    bool feedback_failed = false;
+    const size_t max_pending_frames = 8;
 
     void lfx_sleep(uint64_t frame_id);
     void lfx_end_frame(uint64_t frame_id);
+    void map_frame_id(uint64_t reflex_frame_id);
+
+    bool use_gpu_feedback();
+    bool start_gpu_feedback(ID3D12Device* device);
+    void stop_gpu_feedback();
+    void signal_frame_end(uint64_t frame_id);
+    void feedback_loop();
 
   public:
     LatencyFlex() : LowLatencyTech() {}
@@ -75,17 +75,8 @@ void LowLatency::get_latency_result(NV_VULKAN_LATENCY_RESULT_PARAMS* pGetLatency
         return;
     }
 
-    // Sort frame reports, find the oldest
-    size_t minIdx = 0;
-    uint64_t minID = frame_reports[0].frameID;
-    for (size_t i = 1; i < FRAME_REPORTS_BUFFER_SIZE; i++)
-    {
-        if (frame_reports[i].frameID < minID)
-        {
-            minID = frame_reports[i].frameID;
-            minIdx = i;
-        }
-    }
+    // Find the oldest frame report
+    size_t minIdx = ring_oldest_index(frame_reports);
 
     // Copy starting from older before wrapping around
     size_t firstChunk = std::min<uint64_t>(NVAPI_BUFFER_SIZE, FRAME_REPORTS_BUFFER_SIZE - minIdx);
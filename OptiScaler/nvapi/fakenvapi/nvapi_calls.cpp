@@ -899,4 +899,20 @@ NvAPI_Status __cdecl Fake_SetLowLatencyCtx(void* low_latency_context, LowLatency
 
     return result ? OK() : ERROR();
 }
+
+// count is the size of reports on input and the number of copied reports on output
+NvAPI_Status __cdecl Fake_GetFrameReports(uint64_t after_frame_id, FrameReport* reports, uint32_t* count)
+{
+    if (!reports || !count)
+        return ERROR_VALUE(NVAPI_INVALID_ARGUMENT);
+
+    auto context = LowLatencyCtx::get();
+
+    if (!context)
+        return ERROR();
+
+    *count = (uint32_t) context->get_reports_since(after_frame_id, reports, *count);
+
+    return OK();
+}
 } // namespace nvapi_calls
\ No newline at end of file
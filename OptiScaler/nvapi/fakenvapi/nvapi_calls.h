@@ -144,4 +144,5 @@ NvAPI_Status __cdecl Fake_InformFGState(bool fg_state);
 NvAPI_Status __cdecl Fake_InformPresentFG(bool frame_interpolated, uint64_t reflex_frame_id);
 NvAPI_Status __cdecl Fake_GetLowLatencyCtx(void** low_latency_context, LowLatencyMode* mode);
 NvAPI_Status __cdecl Fake_SetLowLatencyCtx(void* low_latency_context, LowLatencyMode mode);
+NvAPI_Status __cdecl Fake_GetFrameReports(uint64_t after_frame_id, FrameReport* reports, uint32_t* count);
 } // namespace nvapi_calls
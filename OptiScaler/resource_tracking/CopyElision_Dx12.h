@@ -0,0 +1,132 @@
+#pragma once
+
+#include <Config.h>
+#include <framegen/IFGFeature.h>
+#include <framegen/FGCopyElision.h>
+#include "ResourceDesc_Dx12.h"
+
+#include <d3d12.h>
+
+// Skips the per frame depth and motion vector copies of OptiFG when the game doesn't write them before present.
+// Writes are detected from ResTrack_Dx12's ResourceBarrier hook, only enabled while that hook is installed.
+// Without the hook every copy is made. Transitions to another read state count as writes too, FG would use
+// the resource with the state of the tag.
+class CopyElision_Dx12
+{
+    static constexpr D3D12_RESOURCE_STATES WritableStates =
+        D3D12_RESOURCE_STATE_RENDER_TARGET | D3D12_RESOURCE_STATE_UNORDERED_ACCESS |
+        D3D12_RESOURCE_STATE_DEPTH_WRITE | D3D12_RESOURCE_STATE_STREAM_OUT | D3D12_RESOURCE_STATE_COPY_DEST |
+        D3D12_RESOURCE_STATE_RESOLVE_DEST;
+
+    inline static FGCopyElision<ID3D12Resource, ID3D12CommandList, 2> _elision;
+    inline static std::atomic<bool> _enabled = false;
+    inline static std::atomic<D3D12_RESOURCE_STATES> _tagStates[2] {};
+
+    static int SlotIndex(FG_ResourceType type)
+    {
+        if (type == FG_ResourceType::Depth)
+            return 0;
+
+        if (type == FG_ResourceType::Velocity)
+            return 1;
+
+        return -1;
+    }
+
+  public:
+    static void SetEnabled(bool enabled)
+    {
+        _enabled.store(enabled, std::memory_order_release);
+        _elision.Reset();
+    }
+
+    static bool IsEnabled() { return _enabled.load(std::memory_order_acquire); }
+
+    // Called when a resource is tagged with ValidNow, returns false if the copy can be skipped
+    static bool NeedsCopy(FG_ResourceType type, ID3D12Resource* resource, ID3D12GraphicsCommandList* cmdList,
+                          D3D12_RESOURCE_STATES state)
+    {
+        auto slot = SlotIndex(type);
+
+        if (slot < 0)
+            return true;
+
+        auto config = Config::Instance();
+        auto makeCopy = type == FG_ResourceType::Depth ? config->FGMakeDepthCopy.value_or_default()
+                                                       : config->FGMakeMVCopy.value_or_default();
+
+        if (!makeCopy)
+            return false;
+
+        if (!IsEnabled())
+            return true;
+
+        // Writes without a barrier are possible in these cases
+        auto allowElision = config->FGCopyElision.value_or_default() && state != D3D12_RESOURCE_STATE_COMMON &&
+                            (state & WritableStates) == 0 &&
+                            (ResourceDesc_Dx12::Get(resource).Flags &
+                             D3D12_RESOURCE_FLAG_ALLOW_SIMULTANEOUS_ACCESS) == 0;
+
+        _tagStates[slot].store(state, std::memory_order_relaxed);
+
+        return _elision.Tag(slot, resource, cmdList, allowElision);
+    }
+
+    static void ResourceBarrier(ID3D12GraphicsCommandList* cmdList, UINT numBarriers,
+                                const D3D12_RESOURCE_BARRIER* barriers)
+    {
+        if (!_elision.HasWatched())
+            return;
+
+        for (UINT i = 0; i < numBarriers; i++)
+        {
+            auto& barrier = barriers[i];
+
+            if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION)
+            {
+                auto slot = _elision.SlotOf(barrier.Transition.pResource);
+
+                if (slot < 0)
+                    continue;
+
+                // Copy source is only used by our own copy
+                auto after = barrier.Transition.StateAfter;
+
+                if ((after & WritableStates) != 0 ||
+                    (after != _tagStates[slot].load(std::memory_order_relaxed) &&
+                     after != D3D12_RESOURCE_STATE_COPY_SOURCE))
+                {
+                    _elision.Write(barrier.Transition.pResource, cmdList);
+                }
+            }
+            else if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING)
+            {
+                // Contents of the aliased resource are gone
+                if (_elision.SlotOf(barrier.Aliasing.pResourceAfter) >= 0)
+                    _elision.Write(barrier.Aliasing.pResourceAfter, cmdList);
+            }
+        }
+    }
+
+    static void Executed(ID3D12CommandList* const* cmdLists, UINT count) { _elision.Executed(cmdLists, count); }
+
+    // Called after the FG present of the frame
+    static void Present()
+    {
+        if (!IsEnabled())
+            return;
+
+        for (uint32_t slot = 0; slot < 2; slot++)
+        {
+            if (_elision.Present(slot) != decltype(_elision)::Outcome::Violated)
+                continue;
+
+            auto name = slot == 0 ? "Depth" : "Velocity";
+
+            if (_elision.Disabled(slot))
+                LOG_WARN("{} is written after tag too often, copy elision disabled", name);
+            else
+                LOG_DEBUG("{} is written after tag, making copies again", name);
+        }
+    }
+};
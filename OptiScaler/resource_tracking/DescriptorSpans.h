@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+// Splits a CopyDescriptors call into spans which are contiguous in both destination and source,
+// so tracking can be updated per span instead of per descriptor.
+// Adjacent ranges are merged when both sides continue where the previous span ended.
+// Destination descriptors without a source (source ranges ran out) are reported with a source of 0.
+// Handles only need a ptr member (D3D12_CPU_DESCRIPTOR_HANDLE), sizes are null for single descriptor ranges.
+//   void visit(size_t destStart, size_t srcStart, uint32_t count)
+template <typename Handle, typename Visit>
+void ForEachDescriptorSpan(uint32_t numDestRanges, const Handle* destStarts, const uint32_t* destSizes,
+                           uint32_t numSrcRanges, const Handle* srcStarts, const uint32_t* srcSizes, size_t increment,
+                           Visit&& visit)
+{
+    size_t spanDest = 0;
+    size_t spanSrc = 0;
+    uint32_t spanCount = 0;
+
+    auto add = [&](size_t dest, size_t src, uint32_t count)
+    {
+        auto spanSize = static_cast<size_t>(spanCount) * increment;
+
+        if (spanCount > 0 && dest == spanDest + spanSize &&
+            ((src == 0 && spanSrc == 0) || (src != 0 && spanSrc != 0 && src == spanSrc + spanSize)))
+        {
+            spanCount += count;
+            return;
+        }
+
+        if (spanCount > 0)
+            visit(spanDest, spanSrc, spanCount);
+
+        spanDest = dest;
+        spanSrc = src;
+        spanCount = count;
+    };
+
+    uint32_t srcRange = 0;
+    uint32_t srcOffset = 0;
+
+    for (uint32_t d = 0; d < numDestRanges; d++)
+    {
+        const uint32_t destSize = destSizes == nullptr ? 1 : destSizes[d];
+        uint32_t destOffset = 0;
+
+        while (destOffset < destSize)
+        {
+            // Skip used up and empty source ranges
+            while (srcRange < numSrcRanges && srcOffset >= (srcSizes == nullptr ? 1 : srcSizes[srcRange]))
+            {
+                srcRange++;
+                srcOffset = 0;
+            }
+
+            const size_t dest = destStarts[d].ptr + static_cast<size_t>(destOffset) * increment;
+
+            if (srcRange >= numSrcRanges)
+            {
+                add(dest, 0, destSize - destOffset);
+                break;
+            }
+
+            const uint32_t srcSize = srcSizes == nullptr ? 1 : srcSizes[srcRange];
+            const uint32_t count = std::min(destSize - destOffset, srcSize - srcOffset);
+
+            add(dest, srcStarts[srcRange].ptr + static_cast<size_t>(srcOffset) * increment, count);
+
+            destOffset += count;
+            srcOffset += count;
+        }
+    }
+
+    if (spanCount > 0)
+        visit(spanDest, spanSrc, spanCount);
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <d3d12.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Verifies the FG inputs prepared on OptiScaler's compute queue are still in their tagged state when the prep
+// command list is submitted. Prep lists are recorded with the state of the tag but run after the game submitted
+// the frame, a transition the game records after the tag would make their barriers wrong.
+// Transitions are seen from ResTrack_Dx12's ResourceBarrier hook, without the hook inputs are prepared inline.
+class PrepStateCheck_Dx12
+{
+    struct WatchedInput
+    {
+        uint32_t index = 0;
+        ID3D12Resource* resource = nullptr;
+        D3D12_RESOURCE_STATES tagState = D3D12_RESOURCE_STATE_COMMON;
+        D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_COMMON;
+        bool aliased = false;
+    };
+
+    inline static std::mutex _mutex;
+    inline static std::vector<WatchedInput> _watches;
+    inline static std::atomic<bool> _hasWatches = false;
+    inline static std::atomic<bool> _enabled = false;
+
+  public:
+    static void SetEnabled(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _enabled.store(enabled, std::memory_order_release);
+        _watches.clear();
+        _hasWatches.store(false, std::memory_order_release);
+    }
+
+    static bool IsEnabled() { return _enabled.load(std::memory_order_acquire); }
+
+    // Called when prep work of the frame index is recorded for the resource with the state of its tag
+    static void Watch(uint32_t index, ID3D12Resource* resource, D3D12_RESOURCE_STATES state)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (const auto& watch : _watches)
+        {
+            if (watch.index == index && watch.resource == resource)
+                return;
+        }
+
+        _watches.push_back({ index, resource, state, state, false });
+        _hasWatches.store(true, std::memory_order_release);
+    }
+
+    static void ResourceBarrier(UINT numBarriers, const D3D12_RESOURCE_BARRIER* barriers)
+    {
+        if (!_hasWatches.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (UINT i = 0; i < numBarriers; i++)
+        {
+            auto& barrier = barriers[i];
+
+            for (auto& watch : _watches)
+            {
+                if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION &&
+                    barrier.Transition.pResource == watch.resource)
+                {
+                    watch.state = barrier.Transition.StateAfter;
+                }
+                else if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING &&
+                         barrier.Aliasing.pResourceAfter == watch.resource)
+                {
+                    watch.aliased = true;
+                }
+            }
+        }
+    }
+
+    // Called before the prep list of the frame index is submitted, returns false if any of its inputs left the
+    // state of its tag. Watches of the index are cleared.
+    static bool Verify(uint32_t index)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        bool valid = IsEnabled();
+
+        std::erase_if(_watches,
+                      [index, &valid](const WatchedInput& watch)
+                      {
+                          if (watch.index != index)
+                              return false;
+
+                          if (watch.aliased || watch.state != watch.tagState)
+                              valid = false;
+
+                          return true;
+                      });
+
+        _hasWatches.store(!_watches.empty(), std::memory_order_release);
+
+        return valid;
+    }
+};
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ResTrack_dx12.h"
+#include "DescriptorSpans.h"
 
 #include <Config.h>
 #include <State.h>
@@ -77,6 +78,8 @@ typedef void(STDMETHODCALLTYPE* PFN_Dispatch)(ID3D12GraphicsCommandList* This, U
 typedef void(STDMETHODCALLTYPE* PFN_ExecuteBundle)(ID3D12GraphicsCommandList* This,
                                                    ID3D12GraphicsCommandList* pCommandList);
 typedef HRESULT(STDMETHODCALLTYPE* PFN_Close)(ID3D12GraphicsCommandList* This);
+typedef void(STDMETHODCALLTYPE* PFN_ResourceBarrier)(ID3D12GraphicsCommandList* This, UINT NumBarriers,
+                                                     const D3D12_RESOURCE_BARRIER* pBarriers);
 
 typedef void(STDMETHODCALLTYPE* PFN_ExecuteCommandLists)(ID3D12CommandQueue* This, UINT NumCommandLists,
                                                          ID3D12CommandList* const* ppCommandLists);
@@ -102,6 +105,7 @@ static PFN_DrawInstanced o_DrawInstanced = nullptr;
 static PFN_DrawIndexedInstanced o_DrawIndexedInstanced = nullptr;
 static PFN_ExecuteBundle o_ExecuteBundle = nullptr;
 static PFN_Close o_Close = nullptr;
+static PFN_ResourceBarrier o_ResourceBarrier = nullptr;
 
 static PFN_ExecuteCommandLists o_ExecuteCommandLists = nullptr;
 static PFN_Release o_Release = nullptr;
@@ -127,8 +131,13 @@ static std::mutex _heapCreationMutex;
 
 static std::vector<std::unique_ptr<HeapInfo>> fgHeaps;
 
-static std::set<void*> _notFoundCmdLists;
-static std::unordered_map<FG_ResourceType, void*> _resCmdList[BUFFER_COUNT];
+// Closed command lists waiting for execution, indexed by FG_ResourceType.
+// _resCmdListMask has a bit set for every non-null slot so ExecuteCommandLists can skip the lock when idle.
+static void* _resCmdList[BUFFER_COUNT][FG_ResourceType::ResourceTypeCOUNT] {};
+static std::atomic<uint32_t> _resCmdListMask[BUFFER_COUNT] {};
+
+static ankerl::unordered_dense::set<void*> _notFoundCmdLists;
+static std::atomic<bool> _hasNotFoundCmdLists = false;
 
 struct HeapCacheTLS
 {
@@ -152,7 +161,7 @@ bool ResTrack_Dx12::CheckResource(ID3D12Resource* resource)
     if (State::Instance().isShuttingDown)
         return false;
 
-    auto resDesc = resource->GetDesc();
+    auto resDesc = ResourceDesc_Dx12::Get(resource);
 
     if (resDesc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D)
         return false;
@@ -511,7 +520,7 @@ HeapInfo* ResTrack_Dx12::GetHeapByGpuHandleCR(SIZE_T gpuHandle)
 
 void ResTrack_Dx12::FillResourceInfo(ID3D12Resource* resource, ResourceInfo* info)
 {
-    auto desc = resource->GetDesc();
+    auto desc = ResourceDesc_Dx12::Get(resource);
     info->buffer = resource;
     info->width = desc.Width;
     info->height = desc.Height;
@@ -737,16 +746,20 @@ void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resour
 void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumCommandLists,
                                           ID3D12CommandList* const* ppCommandLists)
 {
+    CopyElision_Dx12::Executed(ppCommandLists, NumCommandLists);
+
     auto fg = State::Instance().currentFG;
 
     if (fg != nullptr && fg->IsActive() && !fg->IsPaused())
     {
         LOG_TRACK("NumCommandLists: {}", NumCommandLists);
 
-        std::vector<FG_ResourceType> found;
+        uint32_t found = 0;
         auto fIndex = fg->GetIndex();
 
-        do
+        // Nothing is waiting for execution, don't touch the lock
+        if (_resCmdListMask[fIndex].load(std::memory_order_acquire) != 0 ||
+            _hasNotFoundCmdLists.load(std::memory_order_acquire))
         {
             std::lock_guard<std::mutex> lock2(_resourceCommandListMutex);
 
@@ -754,50 +767,48 @@ void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumComm
             {
                 for (size_t i = 0; i < NumCommandLists; i++)
                 {
-                    if (_notFoundCmdLists.contains(ppCommandLists[i]))
-                    {
+                    if (_notFoundCmdLists.erase(ppCommandLists[i]) > 0)
                         LOG_WARN("Found last frames cmdList: {:X}", (size_t) ppCommandLists[i]);
-                        _notFoundCmdLists.erase(ppCommandLists[i]);
-                    }
                 }
+
+                _hasNotFoundCmdLists.store(!_notFoundCmdLists.empty(), std::memory_order_release);
             }
 
-            if (_resCmdList[fIndex].empty())
-                break;
+            auto pending = _resCmdListMask[fIndex].load(std::memory_order_relaxed);
 
-            for (size_t i = 0; i < NumCommandLists; i++)
+            for (size_t i = 0; i < NumCommandLists && pending != 0; i++)
             {
                 LOG_TRACK("ppCommandLists[{}]: {:X}", i, (size_t) ppCommandLists[i]);
 
-                for (const auto& pair : _resCmdList[fIndex])
+                // At most ResourceTypeCOUNT slots to check per command list
+                for (uint32_t type = 0; type < FG_ResourceType::ResourceTypeCOUNT; type++)
                 {
-                    if (pair.second == ppCommandLists[i])
-                    {
-                        LOG_DEBUG("found {} cmdList: {:X}, queue: {:X}", (UINT) pair.first, (size_t) pair.second,
-                                  (size_t) This);
-                        fg->SetResourceReady(pair.first);
-                        found.push_back(pair.first);
-                    }
-                }
+                    auto bit = 1u << type;
 
-                for (size_t i = 0; i < found.size(); i++)
-                {
-                    _resCmdList[fIndex].erase(found[i]);
-                }
+                    if ((pending & bit) == 0 || _resCmdList[fIndex][type] != ppCommandLists[i])
+                        continue;
 
-                if (_resCmdList[fIndex].empty())
-                    break;
+                    LOG_DEBUG("found {} cmdList: {:X}, queue: {:X}", type, (size_t) ppCommandLists[i],
+                              (size_t) This);
+
+                    fg->SetResourceReady((FG_ResourceType) type, fIndex);
+                    _resCmdList[fIndex][type] = nullptr;
+                    pending &= ~bit;
+                    found |= bit;
+                }
             }
 
-        } while (false);
+            _resCmdListMask[fIndex].store(pending, std::memory_order_release);
+        }
 
-        if (!found.empty())
+        if (found != 0)
         {
             o_ExecuteCommandLists(This, NumCommandLists, ppCommandLists);
 
-            for (size_t i = 0; i < found.size(); i++)
+            for (uint32_t type = 0; type < FG_ResourceType::ResourceTypeCOUNT; type++)
             {
-                fg->SetCommandQueue(found[i], This);
+                if ((found & (1u << type)) != 0)
+                    fg->SetCommandQueue((FG_ResourceType) type, This);
             }
 
             return;
@@ -958,7 +969,14 @@ HRESULT ResTrack_Dx12::hkCreateDescriptorHeap(ID3D12Device* This, D3D12_DESCRIPT
 ULONG ResTrack_Dx12::hkRelease(ID3D12Resource* This)
 {
     if (State::Instance().isShuttingDown)
-        return o_Release(This);
+    {
+        auto result = o_Release(This);
+
+        if (result == 0)
+            ResourceDesc_Dx12::Released(This);
+
+        return result;
+    }
 
     std::vector<ResourceInfo*> toClean;
     {
@@ -967,10 +985,15 @@ ULONG ResTrack_Dx12::hkRelease(ID3D12Resource* This)
         This->AddRef();
         auto refCount = o_Release(This);
 
-        if (refCount <= 1 && _trackedResources.contains(This))
+        if (refCount <= 1)
         {
-            toClean = _trackedResources[This]; // Copy vector
-            _trackedResources.erase(This);
+            ResourceDesc_Dx12::Released(This);
+
+            if (_trackedResources.contains(This))
+            {
+                toClean = _trackedResources[This]; // Copy vector
+                _trackedResources.erase(This);
+            }
         }
     }
 
@@ -985,7 +1008,14 @@ ULONG ResTrack_Dx12::hkRelease(ID3D12Resource* This)
     }
 
     State::Instance().CapturedHudlesses.erase(This);
-    return o_Release(This);
+
+    auto result = o_Release(This);
+
+    // Another thread might have released it at the same time
+    if (result == 0)
+        ResourceDesc_Dx12::Released(This);
+
+    return result;
 }
 
 void ResTrack_Dx12::hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptorRanges,
@@ -1013,86 +1043,11 @@ void ResTrack_Dx12::hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptor
     // Validate that we have source descriptors to copy
     bool haveSources = (NumSrcDescriptorRanges > 0 && pSrcDescriptorRangeStarts != nullptr);
 
-    // Track positions in both source and destination ranges
-    UINT srcRangeIndex = 0;
-    UINT srcOffsetInRange = 0;
-    UINT destRangeIndex = 0;
-    UINT destOffsetInRange = 0;
-
-    // Cache for heap lookups to avoid repeated lookups within the same range
-    HeapInfo* cachedDestHeap = nullptr;
-    SIZE_T cachedDestRangeStart = 0;
-    UINT cachedDestRangeSize = 0;
-    HeapInfo* cachedSrcHeap = nullptr;
-    SIZE_T cachedSrcRangeStart = 0;
-    UINT cachedSrcRangeSize = 0;
-
-    // Process all destination descriptors
-    while (destRangeIndex < NumDestDescriptorRanges)
-    {
-        // Update destination heap cache if we've moved to a new range
-        if (destOffsetInRange == 0)
-        {
-            cachedDestRangeStart = pDestDescriptorRangeStarts[destRangeIndex].ptr;
-            cachedDestRangeSize =
-                (pDestDescriptorRangeSizes == nullptr) ? 1 : pDestDescriptorRangeSizes[destRangeIndex];
-            cachedDestHeap = GetHeapByCpuHandle(cachedDestRangeStart);
-        }
-
-        // Calculate current destination handle
-        const SIZE_T destHandle = cachedDestRangeStart + (static_cast<SIZE_T>(destOffsetInRange) * inc);
-
-        // Get or update source information
-        ResourceInfo* srcInfo = nullptr;
-        if (haveSources && srcRangeIndex < NumSrcDescriptorRanges)
-        {
-            // Update source heap cache if we've moved to a new range
-            if (srcOffsetInRange == 0)
-            {
-                cachedSrcRangeStart = pSrcDescriptorRangeStarts[srcRangeIndex].ptr;
-                cachedSrcRangeSize =
-                    (pSrcDescriptorRangeSizes == nullptr) ? 1 : pSrcDescriptorRangeSizes[srcRangeIndex];
-                cachedSrcHeap = GetHeapByCpuHandle(cachedSrcRangeStart);
-            }
-
-            // Calculate current source handle
-            const SIZE_T srcHandle = cachedSrcRangeStart + (static_cast<SIZE_T>(srcOffsetInRange) * inc);
-
-            // Get source resource info with proper synchronization
-            if (cachedSrcHeap != nullptr)
-            {
-                // Access to heap info is synchronized through HeapInfo's const methods
-                // which use _trackedResourcesMutex internally
-                srcInfo = cachedSrcHeap->GetByCpuHandle(srcHandle);
-            }
-
-            // Advance source position
-            srcOffsetInRange++;
-            if (srcOffsetInRange >= cachedSrcRangeSize)
-            {
-                srcOffsetInRange = 0;
-                srcRangeIndex++;
-            }
-        }
-
-        // Update destination heap tracking with proper synchronization
-        if (cachedDestHeap != nullptr)
-        {
-            // HeapInfo's Set/Clear methods use _trackedResourcesMutex internally
-            if (srcInfo != nullptr && srcInfo->buffer != nullptr)
-                cachedDestHeap->SetByCpuHandle(destHandle, *srcInfo);
-            else
-                cachedDestHeap->ClearByCpuHandle(destHandle);
-        }
-
-        // Advance destination position
-        destOffsetInRange++;
-        if (destOffsetInRange >= cachedDestRangeSize)
-        {
-            destOffsetInRange = 0;
-            destRangeIndex++;
-        }
-    }
+    // Heaps are looked up and tracking is updated once per contiguous span instead of per descriptor
+    ForEachDescriptorSpan(NumDestDescriptorRanges, pDestDescriptorRangeStarts, pDestDescriptorRangeSizes,
+                          haveSources ? NumSrcDescriptorRanges : 0, pSrcDescriptorRangeStarts,
+                          pSrcDescriptorRangeSizes, inc, [inc](SIZE_T destHandle, SIZE_T srcHandle, UINT count)
+                          { TrackDescriptorSpan(destHandle, srcHandle, count, inc); });
 }
 
 void ResTrack_Dx12::hkCopyDescriptorsSimple(ID3D12Device* This, UINT NumDescriptors,
@@ -1112,40 +1067,43 @@ void ResTrack_Dx12::hkCopyDescriptorsSimple(ID3D12Device* This, UINT NumDescript
 
     auto size = This->GetDescriptorHandleIncrementSize(DescriptorHeapsType);
 
-    for (size_t i = 0; i < NumDescriptors; i++)
+    if (NumDescriptors > 0)
+        TrackDescriptorSpan(DestDescriptorRangeStart.ptr, SrcDescriptorRangeStart.ptr, NumDescriptors, size);
+}
+
+void ResTrack_Dx12::TrackDescriptorSpan(SIZE_T destHandle, SIZE_T srcHandle, UINT count, UINT increment)
+{
+    // Spans merged from adjacent ranges may continue in another heap
+    while (count > 0)
     {
-        HeapInfo* srcHeap = nullptr;
-        SIZE_T srcHandle = 0;
+        UINT part = 1;
+        auto destHeap = GetHeapByCpuHandle(destHandle);
 
-        // source
-        if (SrcDescriptorRangeStart.ptr != 0)
+        if (destHeap != nullptr)
         {
-            srcHandle = SrcDescriptorRangeStart.ptr + i * size;
-            srcHeap = GetHeapByCpuHandle(srcHandle);
-        }
+            part = (UINT) std::min<SIZE_T>(count, (destHeap->cpuEnd - destHandle + increment - 1) / increment);
 
-        auto destHandle = DestDescriptorRangeStart.ptr + i * size;
-        auto dstHeap = GetHeapByCpuHandle(destHandle);
+            HeapInfo* srcHeap = nullptr;
 
-        // destination
-        if (dstHeap == nullptr)
-            continue;
-
-        if (srcHeap == nullptr)
-        {
-            dstHeap->ClearByCpuHandle(destHandle);
-            continue;
-        }
+            if (srcHandle != 0)
+            {
+                srcHeap = GetHeapByCpuHandle(srcHandle);
 
-        auto buffer = srcHeap->GetByCpuHandle(srcHandle);
+                // Untracked source, clear one by one until a tracked heap starts
+                if (srcHeap == nullptr)
+                    part = 1;
+                else
+                    part = (UINT) std::min<SIZE_T>(part, (srcHeap->cpuEnd - srcHandle + increment - 1) / increment);
+            }
 
-        if (buffer == nullptr)
-        {
-            dstHeap->ClearByCpuHandle(destHandle);
-            continue;
+            destHeap->CopyByCpuHandle(destHandle, srcHeap, srcHandle, part);
         }
 
-        dstHeap->SetByCpuHandle(destHandle, *buffer);
+        count -= part;
+        destHandle += (SIZE_T) part * increment;
+
+        if (srcHandle != 0)
+            srcHandle += (SIZE_T) part * increment;
     }
 }
 
@@ -1728,24 +1686,24 @@ void ResTrack_Dx12::hkExecuteBundle(ID3D12GraphicsCommandList* This, ID3D12Graph
     {
         std::lock_guard<std::mutex> lock(_resourceCommandListMutex);
 
-        if (fg != nullptr && fg->IsActive() && (_resourceCommandList[index].size() > 0 || !_resCmdList[index].empty()))
+        auto pending = _resCmdListMask[index].load(std::memory_order_relaxed);
+
+        if (fg != nullptr && fg->IsActive() && (_resourceCommandList[index].size() > 0 || pending != 0))
         {
             if (_notFoundCmdLists.contains(pCommandList))
                 LOG_WARN("Found last frames cmdList: {:X}", (size_t) This);
 
-            auto frameCmdList = _resourceCommandList[index];
-            for (std::unordered_map<FG_ResourceType, ID3D12GraphicsCommandList*>::iterator it = frameCmdList.begin();
-                 it != frameCmdList.end(); ++it)
+            auto& frameCmdList = _resourceCommandList[index];
+            for (auto it = frameCmdList.begin(); it != frameCmdList.end(); ++it)
             {
                 if (it->second == pCommandList)
                     it->second = This;
             }
 
-            for (std::unordered_map<FG_ResourceType, void*>::iterator it = _resCmdList[index].begin();
-                 it != _resCmdList[index].end(); ++it)
+            for (uint32_t type = 0; type < FG_ResourceType::ResourceTypeCOUNT; type++)
             {
-                if (it->second == pCommandList)
-                    it->second = This;
+                if ((pending & (1u << type)) != 0 && _resCmdList[index][type] == pCommandList)
+                    _resCmdList[index][type] = This;
             }
         }
     }
@@ -1777,6 +1735,7 @@ HRESULT ResTrack_Dx12::hkClose(ID3D12GraphicsCommandList* This)
                 {
                     LOG_DEBUG("{} cmdList: {:X}", (UINT) pair.first, (size_t) This);
                     _resCmdList[index][pair.first] = pair.second;
+                    _resCmdListMask[index].fetch_or(FGResourceBit(pair.first), std::memory_order_release);
                     found.push_back(pair.first);
                 }
             }
@@ -1791,6 +1750,18 @@ HRESULT ResTrack_Dx12::hkClose(ID3D12GraphicsCommandList* This)
     return o_Close(This);
 }
 
+void ResTrack_Dx12::hkResourceBarrier(ID3D12GraphicsCommandList* This, UINT NumBarriers,
+                                      const D3D12_RESOURCE_BARRIER* pBarriers)
+{
+    if (pBarriers != nullptr)
+    {
+        CopyElision_Dx12::ResourceBarrier(This, NumBarriers, pBarriers);
+        PrepStateCheck_Dx12::ResourceBarrier(NumBarriers, pBarriers);
+    }
+
+    o_ResourceBarrier(This, NumBarriers, pBarriers);
+}
+
 void ResTrack_Dx12::hkDispatch(ID3D12GraphicsCommandList* This, UINT ThreadGroupCountX, UINT ThreadGroupCountY,
                                UINT ThreadGroupCountZ)
 {
@@ -1942,6 +1913,8 @@ void ResTrack_Dx12::HookResource(ID3D12Device* InDevice)
             DetourTransactionCommit();
 
             o_Release(tmp); // drop temp
+
+            ResourceDesc_Dx12::SetEnabled(true);
         }
         else
         {
@@ -1985,6 +1958,9 @@ void ResTrack_Dx12::HookCommandList(ID3D12Device* InDevice)
 
             o_ExecuteBundle = (PFN_ExecuteBundle) pVTable[27];
 
+            // FG copy elision
+            o_ResourceBarrier = (PFN_ResourceBarrier) pVTable[26];
+
             if (o_OMSetRenderTargets != nullptr)
             {
                 DetourTransactionBegin();
@@ -2010,6 +1986,9 @@ void ResTrack_Dx12::HookCommandList(ID3D12Device* InDevice)
 
                     if (o_Dispatch != nullptr)
                         DetourAttach(&(PVOID&) o_Dispatch, hkDispatch);
+
+                    if (o_ResourceBarrier != nullptr)
+                        DetourAttach(&(PVOID&) o_ResourceBarrier, hkResourceBarrier);
                 }
 
                 if (o_Close != nullptr)
@@ -2019,6 +1998,11 @@ void ResTrack_Dx12::HookCommandList(ID3D12Device* InDevice)
                     DetourAttach(&(PVOID&) o_ExecuteBundle, hkExecuteBundle);
 
                 DetourTransactionCommit();
+
+                CopyElision_Dx12::SetEnabled(State::Instance().activeFgInput == FGInput::Upscaler &&
+                                             o_ResourceBarrier != nullptr);
+                PrepStateCheck_Dx12::SetEnabled(State::Instance().activeFgInput == FGInput::Upscaler &&
+                                                o_ResourceBarrier != nullptr);
             }
 
             commandList->Close();
@@ -2190,6 +2174,9 @@ void ResTrack_Dx12::ReleaseDeviceHooks()
     if (o_ExecuteBundle != nullptr)
         DetourDetach(&(PVOID&) o_ExecuteBundle, hkExecuteBundle);
 
+    if (o_ResourceBarrier != nullptr)
+        DetourDetach(&(PVOID&) o_ResourceBarrier, hkResourceBarrier);
+
     // Resource
     if (o_Release != nullptr)
         DetourDetach(&(PVOID&) o_Release, hkRelease);
@@ -2216,9 +2203,13 @@ void ResTrack_Dx12::ReleaseDeviceHooks()
     o_Dispatch = nullptr;
     o_Close = nullptr;
     o_ExecuteBundle = nullptr;
+    o_ResourceBarrier = nullptr;
+    CopyElision_Dx12::SetEnabled(false);
+    PrepStateCheck_Dx12::SetEnabled(false);
 
     // Resource
     o_Release = nullptr;
+    ResourceDesc_Dx12::SetEnabled(false);
 }
 
 void ResTrack_Dx12::ReleaseHooks()
@@ -2287,6 +2278,9 @@ void ResTrack_Dx12::ReleaseHooks()
     if (o_ExecuteBundle != nullptr)
         DetourDetach(&(PVOID&) o_ExecuteBundle, hkExecuteBundle);
 
+    if (o_ResourceBarrier != nullptr)
+        DetourDetach(&(PVOID&) o_ResourceBarrier, hkResourceBarrier);
+
     o_OMSetRenderTargets = nullptr;
     o_SetGraphicsRootDescriptorTable = nullptr;
     o_SetComputeRootDescriptorTable = nullptr;
@@ -2295,6 +2289,9 @@ void ResTrack_Dx12::ReleaseHooks()
     o_Dispatch = nullptr;
     o_Close = nullptr;
     o_ExecuteBundle = nullptr;
+    o_ResourceBarrier = nullptr;
+    CopyElision_Dx12::SetEnabled(false);
+    PrepStateCheck_Dx12::SetEnabled(false);
 
     DetourTransactionCommit();
 }
@@ -2344,13 +2341,19 @@ void ResTrack_Dx12::ClearPossibleHudless()
 
         _resourceCommandList[fIndex].clear();
 
-        for (const auto& pair : _resCmdList[fIndex])
+        auto pending = _resCmdListMask[fIndex].exchange(0, std::memory_order_acq_rel);
+
+        for (uint32_t type = 0; type < FG_ResourceType::ResourceTypeCOUNT; type++)
         {
-            LOG_WARN("{} cmdList: {:X}, not executed!", (UINT) pair.first, (size_t) pair.second);
-            _notFoundCmdLists.insert(pair.second);
+            if ((pending & (1u << type)) == 0)
+                continue;
+
+            LOG_WARN("{} cmdList: {:X}, not executed!", type, (size_t) _resCmdList[fIndex][type]);
+            _notFoundCmdLists.insert(_resCmdList[fIndex][type]);
+            _resCmdList[fIndex][type] = nullptr;
         }
 
-        _resCmdList[fIndex].clear();
+        _hasNotFoundCmdLists.store(!_notFoundCmdLists.empty(), std::memory_order_release);
     }
 }
 
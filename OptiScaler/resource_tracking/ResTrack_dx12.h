@@ -4,6 +4,9 @@
 
 #include <hudfix/Hudfix_Dx12.h>
 #include <framegen/IFGFeature_Dx12.h>
+#include "ResourceDesc_Dx12.h"
+#include "CopyElision_Dx12.h"
+#include "PrepStateCheck_Dx12.h"
 
 #include <ankerl/unordered_dense.h>
 
@@ -158,12 +161,9 @@ struct HeapInfo
         }
     }
 
-    void DetachFromOldResource(SIZE_T index) const
+    // Reverse map updates, _trackedResourcesMutex must be held
+    void DetachLocked(SIZE_T index) const
     {
-        if (info[index].buffer == nullptr)
-            return;
-
-        std::scoped_lock lock(_trackedResourcesMutex);
         LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}, Res: {}x{}, Format: {}", (size_t) this, index,
                   (size_t) info[index].buffer, info[index].width, info[index].height, (UINT) info[index].format);
         auto it = _trackedResources.find(info[index].buffer);
@@ -176,9 +176,8 @@ struct HeapInfo
         }
     }
 
-    void AttachToNewResource(SIZE_T index) const
+    void AttachLocked(SIZE_T index) const
     {
-        std::scoped_lock lock(_trackedResourcesMutex);
         LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}, Res: {}x{}, Format: {}", (size_t) this, index,
                   (size_t) info[index].buffer, info[index].width, info[index].height, (UINT) info[index].format);
         auto& vec = _trackedResources[info[index].buffer];
@@ -186,6 +185,21 @@ struct HeapInfo
             vec.push_back(&info[index]);
     }
 
+    void DetachFromOldResource(SIZE_T index) const
+    {
+        if (info[index].buffer == nullptr)
+            return;
+
+        std::scoped_lock lock(_trackedResourcesMutex);
+        DetachLocked(index);
+    }
+
+    void AttachToNewResource(SIZE_T index) const
+    {
+        std::scoped_lock lock(_trackedResourcesMutex);
+        AttachLocked(index);
+    }
+
     ResourceInfo* GetByCpuHandle(SIZE_T cpuHandle) const
     {
         auto index = (cpuHandle - cpuStart) / increment;
@@ -306,6 +320,61 @@ struct HeapInfo
         info[index].buffer = nullptr;
         info[index].lastUsedFrame = 0;
     }
+
+    // Copies count descriptors from srcHeap starting at srcHandle, reverse map is updated under a single lock.
+    // Descriptors without a tracked source (srcHeap is null or out of range) are cleared.
+    // Like SetByCpuHandle, descriptors which already point to the source buffer are kept as they are.
+    void CopyByCpuHandle(SIZE_T cpuHandle, const HeapInfo* srcHeap, SIZE_T srcHandle, UINT count) const
+    {
+        auto index = (cpuHandle - cpuStart) / increment;
+
+        if (index >= numDescriptors)
+            return;
+
+        count = (UINT) std::min<SIZE_T>(count, numDescriptors - index);
+
+        SIZE_T srcIndex = 0;
+        UINT srcCount = 0;
+
+        if (srcHeap != nullptr)
+        {
+            srcIndex = (srcHandle - srcHeap->cpuStart) / srcHeap->increment;
+
+            if (srcIndex < srcHeap->numDescriptors)
+                srcCount = (UINT) std::min<SIZE_T>(count, srcHeap->numDescriptors - srcIndex);
+        }
+
+        std::scoped_lock lock(_trackedResourcesMutex);
+
+        for (UINT i = 0; i < count; i++)
+        {
+            auto& dest = info[index + i];
+            const ResourceInfo* src = i < srcCount ? &srcHeap->info[srcIndex + i] : nullptr;
+
+            if (src != nullptr && src->buffer != nullptr)
+            {
+#ifdef DEBUG_TRACKING
+                TestResource(const_cast<ResourceInfo*>(src));
+#endif
+                if (dest.buffer == src->buffer)
+                    continue;
+
+                if (dest.buffer != nullptr)
+                    DetachLocked(index + i);
+
+                dest = *src;
+                AttachLocked(index + i);
+            }
+            else
+            {
+                if (dest.buffer != nullptr)
+                    DetachLocked(index + i);
+
+                dest.buffer = nullptr;
+                dest.lastUsedFrame = 0;
+            }
+        }
+    }
 };
 
 struct ResourceHeapInfo
@@ -385,6 +454,9 @@ class ResTrack_Dx12
 
     static HRESULT hkClose(ID3D12GraphicsCommandList* This);
 
+    static void hkResourceBarrier(ID3D12GraphicsCommandList* This, UINT NumBarriers,
+                                  const D3D12_RESOURCE_BARRIER* pBarriers);
+
     static void hkCreateRenderTargetView(ID3D12Device* This, ID3D12Resource* pResource,
                                          D3D12_RENDER_TARGET_VIEW_DESC* pDesc,
                                          D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor);
@@ -425,6 +497,7 @@ class ResTrack_Dx12
     static HeapInfo* GetHeapByCpuHandleSRV(SIZE_T cpuHandle);
     static HeapInfo* GetHeapByCpuHandleUAV(SIZE_T cpuHandle);
     static HeapInfo* GetHeapByCpuHandle(SIZE_T cpuHandle);
+    static void TrackDescriptorSpan(SIZE_T destHandle, SIZE_T srcHandle, UINT count, UINT increment);
     static HeapInfo* GetHeapByGpuHandleGR(SIZE_T gpuHandle);
     static HeapInfo* GetHeapByGpuHandleCR(SIZE_T gpuHandle);
 
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <d3d12.h>
+
+#include <misc/ResourceDescCache.h>
+
+// Process wide cache of ID3D12Resource::GetDesc results.
+// Only active while ResTrack_Dx12's Release hook is installed, that is where entries get invalidated.
+// Without the hook every call goes to GetDesc.
+class ResourceDesc_Dx12
+{
+    inline static ResourceDescCache<ID3D12Resource, D3D12_RESOURCE_DESC> _cache;
+
+  public:
+    static D3D12_RESOURCE_DESC Get(ID3D12Resource* resource)
+    {
+        return _cache.Get(resource, [](ID3D12Resource* res) { return res->GetDesc(); });
+    }
+
+    static void SetEnabled(bool enabled) { _cache.SetEnabled(enabled); }
+    static void Released(ID3D12Resource* resource) { _cache.Invalidate(resource); }
+};
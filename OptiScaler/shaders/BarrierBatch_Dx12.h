@@ -0,0 +1,85 @@
+#pragma once
+
+#include "BarrierPlanner.h"
+
+#include <d3d12.h>
+
+// Batches the barriers OptiScaler records on a command list during one of its passes.
+// While a batch is alive, ResourceBarrier and SetBufferState calls for its command list are queued here and
+// issued with a single ResourceBarrier call before the next dispatch, draw or copy, or when the batch ends.
+// Calls for other command lists are not affected.
+class BarrierBatch_Dx12
+{
+    inline static thread_local BarrierBatch_Dx12* _current = nullptr;
+
+    BarrierPlanner<ID3D12Resource*, D3D12_RESOURCE_STATES> _planner;
+    ID3D12GraphicsCommandList* _commandList;
+    BarrierBatch_Dx12* _previous;
+
+  public:
+    explicit BarrierBatch_Dx12(ID3D12GraphicsCommandList* InCommandList)
+        : _commandList(InCommandList), _previous(_current)
+    {
+        // Keep the order of barriers which were queued by an outer batch
+        if (_previous != nullptr && _previous->_commandList == InCommandList)
+            _previous->Flush();
+
+        _current = this;
+    }
+
+    ~BarrierBatch_Dx12()
+    {
+        Flush();
+        _current = _previous;
+    }
+
+    BarrierBatch_Dx12(const BarrierBatch_Dx12&) = delete;
+    BarrierBatch_Dx12& operator=(const BarrierBatch_Dx12&) = delete;
+
+    void Flush()
+    {
+        auto count = _planner.Count();
+
+        if (count == 0)
+            return;
+
+        D3D12_RESOURCE_BARRIER barriers[32] = {};
+
+        for (size_t i = 0; i < count; i++)
+        {
+            barriers[i].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+            barriers[i].Transition.pResource = _planner[i].resource;
+            barriers[i].Transition.StateBefore = _planner[i].before;
+            barriers[i].Transition.StateAfter = _planner[i].after;
+            barriers[i].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+        }
+
+        _commandList->ResourceBarrier((UINT) count, barriers);
+        _planner.Clear();
+    }
+
+    // Queues the transition if a batch is recording this command list, returns false otherwise
+    static bool Transition(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
+                           D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState)
+    {
+        auto batch = _current;
+
+        if (batch == nullptr || batch->_commandList != InCommandList)
+            return false;
+
+        if (!batch->_planner.Add(InResource, InBeforeState, InAfterState))
+        {
+            batch->Flush();
+            batch->_planner.Add(InResource, InBeforeState, InAfterState);
+        }
+
+        return true;
+    }
+
+    // Issues the queued barriers of this command list, called before recording work which uses the resources
+    static void FlushPending(ID3D12GraphicsCommandList* InCommandList)
+    {
+        if (_current != nullptr && _current->_commandList == InCommandList)
+            _current->Flush();
+    }
+};
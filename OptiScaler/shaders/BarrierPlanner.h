@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+
+// Collects resource state transitions so they can be issued with a single ResourceBarrier call.
+// A transition which continues the pending one of the same resource is merged into it (A->B, B->C becomes A->C)
+// and a transition which undoes it drops both (A->B, B->A), as long as no GPU work was recorded in between.
+// Doesn't depend on D3D12, Resource and State only need to be comparable.
+template <typename Resource, typename State, size_t MaxTransitions = 32> class BarrierPlanner
+{
+  public:
+    struct Transition
+    {
+        Resource resource;
+        State before;
+        State after;
+    };
+
+  private:
+    Transition _pending[MaxTransitions] {};
+    size_t _count = 0;
+
+  public:
+    // Returns false when there is no room left, caller should flush and add again
+    bool Add(Resource resource, State before, State after)
+    {
+        if (before == after)
+            return true;
+
+        for (size_t i = _count; i-- > 0;)
+        {
+            if (_pending[i].resource != resource)
+                continue;
+
+            // Tracked states don't match, keep both in recorded order
+            if (_pending[i].after != before)
+                break;
+
+            if (_pending[i].before == after)
+            {
+                for (size_t j = i + 1; j < _count; j++)
+                    _pending[j - 1] = _pending[j];
+
+                _count--;
+                return true;
+            }
+
+            _pending[i].after = after;
+            return true;
+        }
+
+        if (_count == MaxTransitions)
+            return false;
+
+        _pending[_count++] = { resource, before, after };
+        return true;
+    }
+
+    size_t Count() const { return _count; }
+    const Transition& operator[](size_t index) const { return _pending[index]; }
+    void Clear() { _count = 0; }
+};
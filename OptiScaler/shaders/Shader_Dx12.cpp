@@ -138,6 +138,12 @@ void Shader_Dx12::SetBufferState(ID3D12GraphicsCommandList* InCommandList, D3D12
     if (BufferState == nullptr || *BufferState == InState)
         return;
 
+    if (BarrierBatch_Dx12::Transition(InCommandList, Buffer, *BufferState, InState))
+    {
+        *BufferState = InState;
+        return;
+    }
+
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Transition.pResource = Buffer;
@@ -1,5 +1,6 @@
 #pragma once
 #include <d3d12.h>
+#include "BarrierBatch_Dx12.h"
 
 class Shader_Dx12
 {
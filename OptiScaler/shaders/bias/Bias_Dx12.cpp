@@ -108,6 +108,7 @@ bool Bias_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCm
     dispatchWidth = static_cast<UINT>((inDesc.Width + InNumThreadsX - 1) / InNumThreadsX);
     dispatchHeight = (inDesc.Height + InNumThreadsY - 1) / InNumThreadsY;
 
+    BarrierBatch_Dx12::FlushPending(InCmdList);
     InCmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
 
     return true;
@@ -109,6 +109,7 @@ bool FT_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
     dispatchWidth = static_cast<UINT>((inDesc.Width + InNumThreadsX - 1) / InNumThreadsX);
     dispatchHeight = (inDesc.Height + InNumThreadsY - 1) / InNumThreadsY;
 
+    BarrierBatch_Dx12::FlushPending(InCmdList);
     InCmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
 
     return true;
@@ -12,6 +12,9 @@ void HudCopy_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* cmdList, ID3D12Res
     if (beforeState == afterState)
         return;
 
+    if (BarrierBatch_Dx12::Transition(cmdList, resource, beforeState, afterState))
+        return;
+
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Transition.pResource = resource;
@@ -51,7 +54,10 @@ bool HudCopy_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* c
         return result;
     }
 
+    BarrierBatch_Dx12 barriers(cmdList);
+
     ResourceBarrier(cmdList, present, presentState, D3D12_RESOURCE_STATE_COPY_SOURCE);
+    barriers.Flush();
 
     cmdList->CopyResource(_buffer, present);
 
@@ -124,11 +130,13 @@ bool HudCopy_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* c
     UINT dispatchWidth = static_cast<UINT>((presentDesc.Width + InNumThreadsX - 1) / InNumThreadsX);
     UINT dispatchHeight = (presentDesc.Height + InNumThreadsY - 1) / InNumThreadsY;
 
+    barriers.Flush();
     cmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
 
     ResourceBarrier(cmdList, _buffer, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE);
     ResourceBarrier(cmdList, present, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COPY_DEST);
 
+    barriers.Flush();
     cmdList->CopyResource(present, _buffer);
 
     // Restore resource states
@@ -31,6 +31,9 @@ void HC_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* cmdList, ID3D12Resource
     if (beforeState == afterState)
         return;
 
+    if (BarrierBatch_Dx12::Transition(cmdList, resource, beforeState, afterState))
+        return;
+
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Transition.pResource = resource;
@@ -238,10 +241,14 @@ bool HC_Dx12::Dispatch(IDXGISwapChain3* sc, ID3D12GraphicsCommandList* cmdList,
         return false;
     }
 
+    BarrierBatch_Dx12 barriers(cmdList);
+
     // Copy Swapchain Buffer to read buffer
     SetBufferState(_counter, cmdList, D3D12_RESOURCE_STATE_COPY_DEST);
     ResourceBarrier(cmdList, scBuffer, D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_COPY_SOURCE);
 
+    barriers.Flush();
+
     if (_buffer != nullptr)
         cmdList->CopyResource(_buffer[_counter], scBuffer);
 
@@ -339,6 +346,7 @@ bool HC_Dx12::Dispatch(IDXGISwapChain3* sc, ID3D12GraphicsCommandList* cmdList,
 
     // Fullscreen triangle
     cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    barriers.Flush();
     cmdList->DrawInstanced(3, 1, 0, 0);
 
     ResourceBarrier(cmdList, scBuffer, D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT);
@@ -137,6 +137,7 @@ bool OS_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
         static_cast<UINT>((State::Instance().currentFeature->DisplayWidth() + InNumThreadsX - 1) / InNumThreadsX);
     dispatchHeight = (State::Instance().currentFeature->DisplayHeight() + InNumThreadsY - 1) / InNumThreadsY;
 
+    BarrierBatch_Dx12::FlushPending(InCmdList);
     InCmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
 
     return true;
@@ -20,14 +20,23 @@ inline static PFN_GetDesc1 o_GetDesc1 = nullptr;
 inline static PFN_GetDesc2 o_GetDesc2 = nullptr;
 inline static PFN_GetDesc3 o_GetDesc3 = nullptr;
 
-inline static std::string toLower(std::string s)
+// Graphics API and driver modules query the adapter for themselves, they should see the real one
+inline static bool IsApiCaller(void* returnAddress)
 {
-    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::tolower(c); });
-    return s;
+    switch (Util::GetCallerModuleId(returnAddress))
+    {
+    case KnownModule::Vulkan:
+    case KnownModule::AmdVlk:
+    case KnownModule::Dxgi:
+    case KnownModule::D3D12:
+    case KnownModule::D3D12Core:
+        return true;
+
+    default:
+        return false;
+    }
 }
 
-inline static bool iequals(const std::string& a, const std::string& b) { return toLower(a) == toLower(b); }
-
 #pragma region DXGI Adapter methods
 
 inline static bool SkipSpoofing()
@@ -47,16 +56,11 @@ HRESULT DxgiSpoofing::hkGetDesc3(IDXGIAdapter4* This, DXGI_ADAPTER_DESC3* pDesc)
 {
     auto result = o_GetDesc3(This, pDesc);
 
-    auto caller = Util::WhoIsTheCaller(_ReturnAddress());
-
-    if (iequals(caller, "vulkan-1.dll") || iequals(caller, "amdvlk64.dll") || iequals(caller, "dxgi.dll") ||
-        iequals(caller, "d3d12.dll") || iequals(caller, "d3d12Core.dll"))
-    {
+    if (IsApiCaller(_ReturnAddress()))
         return result;
-    }
 
 #if _DEBUG
-    LOG_TRACE("result: {:X}, caller: {}", (UINT) result, caller);
+    LOG_TRACE("result: {:X}, caller: {}", (UINT) result, Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
 
     if (result == S_OK)
@@ -96,16 +100,11 @@ HRESULT DxgiSpoofing::hkGetDesc2(IDXGIAdapter2* This, DXGI_ADAPTER_DESC2* pDesc)
 {
     auto result = o_GetDesc2(This, pDesc);
 
-    auto caller = Util::WhoIsTheCaller(_ReturnAddress());
-
-    if (iequals(caller, "vulkan-1.dll") || iequals(caller, "amdvlk64.dll") || iequals(caller, "dxgi.dll") ||
-        iequals(caller, "d3d12.dll") || iequals(caller, "d3d12Core.dll"))
-    {
+    if (IsApiCaller(_ReturnAddress()))
         return result;
-    }
 
 #if _DEBUG
-    LOG_TRACE("result: {:X}, caller: {}", (UINT) result, caller);
+    LOG_TRACE("result: {:X}, caller: {}", (UINT) result, Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
 
     if (result == S_OK)
@@ -147,16 +146,11 @@ HRESULT DxgiSpoofing::hkGetDesc1(IDXGIAdapter1* This, DXGI_ADAPTER_DESC1* pDesc)
 {
     auto result = o_GetDesc1(This, pDesc);
 
-    auto caller = Util::WhoIsTheCaller(_ReturnAddress());
-
-    if (iequals(caller, "vulkan-1.dll") || iequals(caller, "amdvlk64.dll") || iequals(caller, "dxgi.dll") ||
-        iequals(caller, "d3d12.dll") || iequals(caller, "d3d12Core.dll"))
-    {
+    if (IsApiCaller(_ReturnAddress()))
         return result;
-    }
 
 #if _DEBUG
-    LOG_TRACE("result: {:X}, caller: {}", (UINT) result, caller);
+    LOG_TRACE("result: {:X}, caller: {}", (UINT) result, Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
 
     if (result == S_OK)
@@ -198,16 +192,11 @@ HRESULT DxgiSpoofing::hkGetDesc(IDXGIAdapter* This, DXGI_ADAPTER_DESC* pDesc)
 {
     auto result = o_GetDesc(This, pDesc);
 
-    auto caller = Util::WhoIsTheCaller(_ReturnAddress());
-
-    if (iequals(caller, "vulkan-1.dll") || iequals(caller, "amdvlk64.dll") || iequals(caller, "dxgi.dll") ||
-        iequals(caller, "d3d12.dll") || iequals(caller, "d3d12Core.dll"))
-    {
+    if (IsApiCaller(_ReturnAddress()))
         return result;
-    }
 
 #if _DEBUG
-    LOG_TRACE("result: {:X}, caller: {}", (UINT) result, caller);
+    LOG_TRACE("result: {:X}, caller: {}", (UINT) result, Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
 
     if (result == S_OK)
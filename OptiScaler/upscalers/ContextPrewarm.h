@@ -0,0 +1,180 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Builds the next likely upscaler context on a worker before the game asks for it.
+// A predicted key has to stay the same for settleTime before its build starts (window resizes, menus querying
+// every quality mode), a new prediction abandons the old one. Ready contexts are kept for keepTime and handed
+// over by Take when the game creates a feature with the same key.
+// Doesn't depend on any graphics API, builds are started by the caller:
+//   std::future<std::unique_ptr<Context>> launch(const Key& key) // nullptr result when build failed
+template <typename Key, typename Context> class ContextPrewarm
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Stage : uint32_t
+    {
+        Idle,
+        Settling,
+        Building,
+        Ready
+    };
+
+  private:
+    std::mutex _mutex;
+    Stage _stage = Stage::Idle;
+    Key _key {};
+    Clock::time_point _since {};
+
+    std::future<std::unique_ptr<Context>> _build;
+    std::unique_ptr<Context> _ready;
+
+    // Futures of std::async block in their destructor, abandoned builds are kept until they finish
+    std::vector<std::future<std::unique_ptr<Context>>> _abandoned;
+
+    std::chrono::milliseconds _settleTime { 250 };
+    std::chrono::milliseconds _keepTime { 10000 };
+
+    void Abandon()
+    {
+        if (_stage == Stage::Building && _build.valid())
+            _abandoned.push_back(std::move(_build));
+
+        _ready.reset();
+        _stage = Stage::Idle;
+    }
+
+  public:
+    void Configure(std::chrono::milliseconds settleTime, std::chrono::milliseconds keepTime)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _settleTime = settleTime;
+        _keepTime = keepTime;
+    }
+
+    void Predict(const Key& key, Clock::time_point now = Clock::now())
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (_stage != Stage::Idle && _key == key)
+            return;
+
+        Abandon();
+
+        _key = key;
+        _since = now;
+        _stage = Stage::Settling;
+    }
+
+    // Should be called once per frame, starts settled builds and drops unused contexts
+    template <typename Launch> void Tick(Launch&& launch, Clock::time_point now = Clock::now())
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        std::erase_if(_abandoned, [](auto& build)
+                      { return build.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+
+        switch (_stage)
+        {
+        case Stage::Settling:
+            if (now - _since >= _settleTime)
+            {
+                _build = launch(_key);
+                _stage = _build.valid() ? Stage::Building : Stage::Idle;
+            }
+
+            break;
+
+        case Stage::Building:
+            if (_build.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                _ready = _build.get();
+                _stage = _ready != nullptr ? Stage::Ready : Stage::Idle;
+                _since = now;
+            }
+
+            break;
+
+        case Stage::Ready:
+            if (now - _since >= _keepTime)
+                Abandon();
+
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    // Hands over the context built for key, waits if its build is still running.
+    // Returns nullptr when nothing was prepared for this key.
+    std::unique_ptr<Context> Take(const Key& key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (_stage == Stage::Idle || !(_key == key))
+            return nullptr;
+
+        std::unique_ptr<Context> result;
+
+        if (_stage == Stage::Building)
+            result = _build.get();
+        else if (_stage == Stage::Ready)
+            result = std::move(_ready);
+
+        // Game created it on its own while still settling
+        _stage = Stage::Idle;
+
+        return result;
+    }
+
+    void Discard()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        Abandon();
+    }
+
+    Stage GetStage()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stage;
+    }
+
+    size_t AbandonedCount()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _abandoned.size();
+    }
+};
+
+// Render size of the next context from the current one.
+// Games create contexts either with the display size (DRS), with the optimal size of the quality mode or
+// with something else, the new context most likely follows the same pattern.
+inline void PredictRenderSize(uint32_t renderWidth, uint32_t renderHeight, uint32_t displayWidth,
+                              uint32_t displayHeight, uint32_t optimalWidth, uint32_t optimalHeight,
+                              uint32_t newDisplayWidth, uint32_t newDisplayHeight, uint32_t newOptimalWidth,
+                              uint32_t newOptimalHeight, uint32_t* outWidth, uint32_t* outHeight)
+{
+    if (renderWidth == displayWidth && renderHeight == displayHeight)
+    {
+        *outWidth = newDisplayWidth;
+        *outHeight = newDisplayHeight;
+    }
+    else if (renderWidth == optimalWidth && renderHeight == optimalHeight)
+    {
+        *outWidth = newOptimalWidth;
+        *outHeight = newOptimalHeight;
+    }
+    else
+    {
+        *outWidth = (uint32_t) ((uint64_t) newDisplayWidth * renderWidth / (displayWidth > 0 ? displayWidth : 1));
+        *outHeight = (uint32_t) ((uint64_t) newDisplayHeight * renderHeight / (displayHeight > 0 ? displayHeight : 1));
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+
+struct ID3D12Device;
+
+// Creation parameters of a Dx12 feature, prewarmed and pooled features are only used for the same ones.
+// Device is part of the key so a feature is never handed to a recreated device.
+struct FeatureKey_Dx12
+{
+    ID3D12Device* device = nullptr;
+    std::string backend;
+    unsigned int renderWidth = 0;
+    unsigned int renderHeight = 0;
+    unsigned int displayWidth = 0;
+    unsigned int displayHeight = 0;
+    int featureFlags = 0;
+    int perfQuality = 0;
+
+    // Optional creation inputs, 0 when the game didn't provide them
+    int responsivePixelMask = 0;
+    unsigned int upscaleWidth = 0;
+    unsigned int upscaleHeight = 0;
+
+    bool operator==(const FeatureKey_Dx12& other) const = default;
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+// Keeps the features of released handles for a grace period, a handle created again with the same key gets
+// them back instead of building pipelines and allocating history resources again (settings menus, scene captures
+// which create and release their handles).
+// A feature belongs to one handle at a time since its history belongs to one view, so only released features are
+// pooled. Oldest entries are evicted when the pool is full, others when their grace period is over.
+// Not thread safe, callers using it from more than one thread guard it.
+template <typename Key, typename Feature> class FeaturePool
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  private:
+    struct Entry
+    {
+        Key key;
+        std::unique_ptr<Feature> feature;
+        Clock::time_point expireTime {};
+    };
+
+    // Oldest first
+    std::vector<Entry> _entries;
+    size_t _capacity = 2;
+    std::chrono::milliseconds _gracePeriod { 5000 };
+
+    void Trim(size_t count)
+    {
+        if (_entries.size() > count)
+            _entries.erase(_entries.begin(), _entries.begin() + (_entries.size() - count));
+    }
+
+  public:
+    void Configure(size_t capacity, std::chrono::milliseconds gracePeriod)
+    {
+        _capacity = capacity;
+        _gracePeriod = gracePeriod;
+        Trim(_capacity);
+    }
+
+    // Takes the feature of a released handle, returns false when it was destroyed instead
+    bool Release(const Key& key, std::unique_ptr<Feature> feature, Clock::time_point now = Clock::now())
+    {
+        if (feature == nullptr || _capacity == 0 || _gracePeriod.count() <= 0)
+            return false;
+
+        Trim(_capacity - 1);
+        _entries.push_back({ key, std::move(feature), now + _gracePeriod });
+
+        return true;
+    }
+
+    // Returns the most recently released feature with this key, nullptr if there is none
+    std::unique_ptr<Feature> Acquire(const Key& key)
+    {
+        for (auto it = _entries.rbegin(); it != _entries.rend(); ++it)
+        {
+            if (!(it->key == key))
+                continue;
+
+            auto feature = std::move(it->feature);
+            _entries.erase(std::next(it).base());
+
+            return feature;
+        }
+
+        return nullptr;
+    }
+
+    // Destroys the features whose grace period is over
+    void Collect(Clock::time_point now = Clock::now())
+    {
+        if (_entries.empty())
+            return;
+
+        std::erase_if(_entries, [now](const Entry& entry) { return now >= entry.expireTime; });
+    }
+
+    void Clear() { _entries.clear(); }
+    size_t Count() const { return _entries.size(); }
+};
@@ -144,11 +144,8 @@ bool FeatureProvider_Dx11::ChangeFeature(std::string upscalerName, ID3D11Device*
 
             State::Instance().currentFeature = nullptr;
 
-            LOG_TRACE("sleeping before reset of current feature for 1000ms");
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-
-            contextData->feature.reset();
-            contextData->feature = nullptr;
+            // Released once it's not in use anymore instead of blocking the game here
+            contextData->retired.Retire(std::move(contextData->feature), BUFFER_COUNT, std::chrono::milliseconds(1000));
         }
         else
         {
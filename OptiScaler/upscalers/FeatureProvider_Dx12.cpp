@@ -15,7 +15,8 @@
 #include "FeatureProvider_Dx11.h"
 
 bool FeatureProvider_Dx12::GetFeature(std::string_view upscalerName, UINT handleId, NVSDK_NGX_Parameter* parameters,
-                                      std::unique_ptr<IFeature_Dx12>* feature)
+                                      std::unique_ptr<IFeature_Dx12>* feature, std::string* configName,
+                                      bool* fellBack)
 {
     State& state = State::Instance();
     Config& cfg = *Config::Instance();
@@ -65,7 +66,11 @@ bool FeatureProvider_Dx12::GetFeature(std::string_view upscalerName, UINT handle
     // Fail after the constructor
     if (!loaded)
     {
-        ImGui::InsertNotification({ ImGuiToastType::Warning, 10000, "Falling back to FSR 2.1.2" });
+        if (fellBack != nullptr)
+            *fellBack = true;
+        else
+            ImGui::InsertNotification({ ImGuiToastType::Warning, 10000, "Falling back to FSR 2.1.2" });
+
         *feature = std::make_unique<FSR2FeatureDx12_212>(handleId, parameters);
         config_upscaler = "fsr21";
         loaded = true; // Assuming the fallback always loads successfully
@@ -75,11 +80,141 @@ bool FeatureProvider_Dx12::GetFeature(std::string_view upscalerName, UINT handle
     if (config_upscaler == "dlssd")
         config_upscaler = "dlss";
 
-    cfg.Dx12Upscaler = std::string(config_upscaler);
+    if (configName != nullptr)
+        *configName = std::string(config_upscaler);
+    else
+        cfg.Dx12Upscaler = std::string(config_upscaler);
 
     return loaded;
 }
 
+// Keys the backends read while a feature is created. Workers get a copy instead of the game's table,
+// which is written by the game every frame.
+static void CopyCreateParameters(NVSDK_NGX_Parameter* source, NVSDK_NGX_Parameter* target)
+{
+    static const char* uintKeys[] = { NVSDK_NGX_Parameter_Width,
+                                      NVSDK_NGX_Parameter_Height,
+                                      NVSDK_NGX_Parameter_OutWidth,
+                                      NVSDK_NGX_Parameter_OutHeight,
+                                      NVSDK_NGX_Parameter_CreationNodeMask,
+                                      NVSDK_NGX_Parameter_VisibilityNodeMask,
+                                      NVSDK_NGX_Parameter_FreeMemOnReleaseFeature,
+                                      NVSDK_NGX_Parameter_DLSS_Enable_Output_Subrects,
+                                      NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_DLAA,
+                                      NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_UltraQuality,
+                                      NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Quality,
+                                      NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Balanced,
+                                      NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Performance,
+                                      NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_UltraPerformance,
+                                      "RayReconstruction.Hint.Render.Preset.DLAA",
+                                      "RayReconstruction.Hint.Render.Preset.UltraQuality",
+                                      "RayReconstruction.Hint.Render.Preset.Quality",
+                                      "RayReconstruction.Hint.Render.Preset.Balanced",
+                                      "RayReconstruction.Hint.Render.Preset.Performance",
+                                      "RayReconstruction.Hint.Render.Preset.UltraPerformance" };
+
+    static const char* intKeys[] = { NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags,
+                                     NVSDK_NGX_Parameter_PerfQualityValue,
+                                     "DLSS.Use.HW.Depth",
+                                     "DLSS.Denoise.Mode",
+                                     "DLSS.Roughness.Mode",
+                                     "XeSS.ResponsivePixelMask",
+                                     "FSR.upscaleSize.width",
+                                     "FSR.upscaleSize.height" };
+
+    for (auto key : uintKeys)
+    {
+        unsigned int value = 0;
+
+        if (source->Get(key, &value) == NVSDK_NGX_Result_Success)
+            target->Set(key, value);
+    }
+
+    for (auto key : intKeys)
+    {
+        int value = 0;
+
+        if (source->Get(key, &value) == NVSDK_NGX_Result_Success)
+            target->Set(key, value);
+    }
+}
+
+// Init runs on a worker thread so it gets its own command list instead of the game's one
+static bool InitOnWorker(IFeature_Dx12* feature, ID3D12Device* device, NVSDK_NGX_Parameter* parameters)
+{
+    // Config is owned by the game thread, it's updated when the feature is taken from the worker
+    feature->DeferConfigUpdates();
+
+    ID3D12CommandQueue* queue = nullptr;
+    ID3D12CommandAllocator* allocator = nullptr;
+    ID3D12GraphicsCommandList* cmdList = nullptr;
+    ID3D12Fence* fence = nullptr;
+    bool initResult = false;
+
+    do
+    {
+        D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+        queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+        auto result = device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&queue));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateCommandQueue: {:X}", (UINT) result);
+            break;
+        }
+
+        queue->SetName(L"FeatureInitQueue");
+
+        result = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&allocator));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateCommandAllocator: {:X}", (UINT) result);
+            break;
+        }
+
+        result = device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, allocator, nullptr,
+                                           IID_PPV_ARGS(&cmdList));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateCommandList: {:X}", (UINT) result);
+            break;
+        }
+
+        result = device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateFence: {:X}", (UINT) result);
+            break;
+        }
+
+        initResult = feature->Init(device, cmdList, parameters);
+
+        // Execute whatever Init recorded (DLSS creates its feature on the command list) and wait for it
+        cmdList->Close();
+        ID3D12CommandList* cmdLists[] = { cmdList };
+        queue->ExecuteCommandLists(1, cmdLists);
+        queue->Signal(fence, 1);
+
+        if (fence->GetCompletedValue() < 1)
+            fence->SetEventOnCompletion(1, nullptr);
+
+    } while (false);
+
+    if (fence != nullptr)
+        fence->Release();
+
+    if (cmdList != nullptr)
+        cmdList->Release();
+
+    if (allocator != nullptr)
+        allocator->Release();
+
+    if (queue != nullptr)
+        queue->Release();
+
+    return initResult;
+}
+
 bool FeatureProvider_Dx12::ChangeFeature(std::string_view upscalerName, ID3D12Device* device,
                                          ID3D12GraphicsCommandList* cmdList, UINT handleId,
                                          NVSDK_NGX_Parameter* parameters, ContextData<IFeature_Dx12>* contextData)
@@ -90,19 +225,19 @@ bool FeatureProvider_Dx12::ChangeFeature(std::string_view upscalerName, ID3D12De
     if (!state.changeBackend[handleId])
         return false;
 
-    const bool isDlssBeingEnabled = !cfg.DLSSEnabled.value_or_default() && state.newBackend == "dlss";
-
-    // If no name or if dlss is being enabled use the configured upscaler name
-    if (state.newBackend == "" || isDlssBeingEnabled)
-        state.newBackend = cfg.Dx12Upscaler.value_or_default();
+    // Old features are kept for a while in case the GPU or other threads still use them
+    const auto retireDelay = (state.gameQuirks & GameQuirk::FastFeatureReset) ? std::chrono::milliseconds(100)
+                                                                                : std::chrono::milliseconds(1000);
 
-    contextData->changeBackendCounter++;
+    // Start creating the new feature
+    if (!contextData->pendingFeature.valid())
+    {
+        const bool isDlssBeingEnabled = !cfg.DLSSEnabled.value_or_default() && state.newBackend == "dlss";
 
-    LOG_INFO("changeBackend is true, counter: {0}", contextData->changeBackendCounter);
+        // If no name or if dlss is being enabled use the configured upscaler name
+        if (state.newBackend == "" || isDlssBeingEnabled)
+            state.newBackend = cfg.Dx12Upscaler.value_or_default();
 
-    // first release everything
-    if (contextData->changeBackendCounter == 1)
-    {
         if (state.currentFG != nullptr && state.currentFG->IsActive() && state.activeFgInput == FGInput::Upscaler)
         {
             state.currentFG->DestroyFGContext();
@@ -110,16 +245,32 @@ bool FeatureProvider_Dx12::ChangeFeature(std::string_view upscalerName, ID3D12De
             state.ClearCapturedHudlesses = true;
         }
 
-        if (contextData->feature != nullptr)
+        if (contextData->feature == nullptr && contextData->createParams == nullptr)
         {
-            LOG_INFO("changing backend to {}", state.newBackend);
+            LOG_ERROR("can't find handle {0} in Dx12Contexts!", handleId);
+
+            state.newBackend = "";
+            state.changeBackend[handleId] = false;
+            contextData->changeBackendCounter = 0;
+
+            return true;
+        }
+
+        LOG_INFO("changing backend to {}", state.newBackend);
 
+        // Retry after a failed init keeps the previous createParams
+        if (contextData->feature != nullptr)
+        {
             auto* dc = contextData->feature.get();
-            // Use given params if using DLSS passthrough
-            const std::string_view backend = state.newBackend;
-            const bool isPassthrough = backend == "dlssd" || backend == "dlss";
 
-            contextData->createParams = isPassthrough ? parameters : GetNGXParameters("OptiDx12", false);
+            // Game's creation keys are copied, DLSS passthrough needs them and the worker can't read the game's
+            // table while it's being written
+            if (contextData->createParams == nullptr)
+            {
+                contextData->createParams = GetNGXParameters("OptiDx12", false);
+                CopyCreateParameters(parameters, contextData->createParams);
+            }
+
             contextData->createParams->Set(NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, dc->GetFeatureFlags());
             contextData->createParams->Set(NVSDK_NGX_Parameter_Width, dc->RenderWidth());
             contextData->createParams->Set(NVSDK_NGX_Parameter_Height, dc->RenderHeight());
@@ -127,110 +278,119 @@ bool FeatureProvider_Dx12::ChangeFeature(std::string_view upscalerName, ID3D12De
             contextData->createParams->Set(NVSDK_NGX_Parameter_OutHeight, dc->DisplayHeight());
             contextData->createParams->Set(NVSDK_NGX_Parameter_PerfQualityValue, dc->PerfQualityValue());
 
-            dc = nullptr;
-
-            State::Instance().currentFeature = nullptr;
-
-            if (state.gameQuirks & GameQuirk::FastFeatureReset)
+            // Current feature can't be used anymore, retire it right away
+            if (!contextData->canServeWhileChanging || !dc->IsInited())
             {
-                LOG_DEBUG("sleeping before reset of current feature for 100ms (Fast Feature Reset)");
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            }
-            else
-            {
-                LOG_DEBUG("sleeping before reset of current feature for 1000ms");
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            }
+                if (state.currentFeature == dc)
+                    state.currentFeature = nullptr;
 
-            contextData->feature.reset();
-            contextData->feature = nullptr;
+                contextData->retired.Retire(std::move(contextData->feature), BUFFER_COUNT, retireDelay);
+            }
         }
-        else // Clean up state if no feature is set
-        {
-            LOG_ERROR("can't find handle {0} in Dx12Contexts!", handleId);
 
-            state.newBackend = "";
-            state.changeBackend[handleId] = false;
+        contextData->changeBackendCounter = 1;
+
+        LOG_INFO("Creating new {} upscaler", state.newBackend);
 
-            if (contextData->createParams != nullptr)
+        contextData->pendingFeature = std::async(
+            std::launch::async,
+            [backend = std::string(state.newBackend), handleId, device, createParams = contextData->createParams]()
             {
-                TryDestroyNGXParameters(contextData->createParams, NVNGXProxy::D3D12_DestroyParameters());
-                contextData->createParams = nullptr;
-            }
+                PendingFeature<IFeature_Dx12> result {};
 
-            contextData->changeBackendCounter = 0;
-        }
+                if (!GetFeature(backend, handleId, createParams, &result.feature, &result.configName,
+                                &result.fellBack))
+                {
+                    LOG_ERROR("Upscaler can't created");
+                    result.feature.reset();
+                    return result;
+                }
+
+                if (!InitOnWorker(result.feature.get(), device, createParams))
+                {
+                    LOG_ERROR("init failed with {0} feature", backend);
+                    result.notifications = result.feature->TakeNotifications();
+                    result.feature.reset();
+                }
+                else
+                {
+                    SetCreationKey(result.feature.get(), device, result.configName, createParams);
+                }
+
+                return result;
+            });
 
         return true;
     }
 
-    // create new feature
-    if (contextData->changeBackendCounter == 2)
+    // Still creating, current feature (if any) keeps serving frames
+    if (contextData->pendingFeature.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
     {
-        LOG_INFO("Creating new {} upscaler", state.newBackend);
-        contextData->feature.reset();
-
-        if (!GetFeature(state.newBackend, handleId, contextData->createParams, &contextData->feature))
-        {
-            LOG_ERROR("Upscaler can't created");
-            return false;
-        }
-
+        contextData->changeBackendCounter++;
         return true;
     }
 
-    // init feature
-    if (contextData->changeBackendCounter == 3)
-    {
-        auto initResult = contextData->feature->Init(device, cmdList, contextData->createParams);
+    auto pending = contextData->pendingFeature.get();
+    auto changeFrames = contextData->changeBackendCounter;
+    contextData->changeBackendCounter = 0;
 
-        contextData->changeBackendCounter = 0;
+    for (const auto& [type, text] : pending.notifications)
+        ImGui::InsertNotification({ type, 10000, text.c_str() });
 
-        if (!initResult)
+    if (pending.feature == nullptr)
+    {
+        if (state.newBackend != "dlssd")
         {
-            LOG_ERROR("init failed with {0} feature", state.newBackend);
-
-            if (state.newBackend != "dlssd")
+            if (pending.configName == "dlss")
             {
-                if (cfg.Dx12Upscaler == "dlss")
-                {
-                    state.newBackend = "xess";
-                    ImGui::InsertNotification({ ImGuiToastType::Warning, 10000, "Falling back to XeSS" });
-                }
-                else
-                {
-                    state.newBackend = "fsr21";
-                    ImGui::InsertNotification({ ImGuiToastType::Warning, 10000, "Falling back to FSR 2.1.2" });
-                }
+                state.newBackend = "xess";
+                ImGui::InsertNotification({ ImGuiToastType::Warning, 10000, "Falling back to XeSS" });
             }
             else
             {
-                // Retry DLSSD
-                state.newBackend = "dlssd";
+                state.newBackend = "fsr21";
+                ImGui::InsertNotification({ ImGuiToastType::Warning, 10000, "Falling back to FSR 2.1.2" });
             }
-
-            state.changeBackend[handleId] = true;
-            return NVSDK_NGX_Result_Success;
         }
         else
         {
-            LOG_INFO("init successful for {0}, upscaler changed", state.newBackend);
-
-            state.newBackend = "";
-            state.changeBackend[handleId] = false;
+            // Retry DLSSD
+            state.newBackend = "dlssd";
         }
 
-        // If this is an OptiScaler fake NVNGX param table, delete it
-        int optiParam = 0;
+        state.changeBackend[handleId] = true;
+        return true;
+    }
 
-        if (contextData->createParams->Get("OptiScaler", &optiParam) == NVSDK_NGX_Result_Success && optiParam == 1)
-        {
-            TryDestroyNGXParameters(contextData->createParams, NVNGXProxy::D3D12_DestroyParameters());
-            contextData->createParams = nullptr;
-        }
+    LOG_INFO("init successful for {0}, upscaler changed after {1} frames", state.newBackend, changeFrames);
+
+    cfg.Dx12Upscaler = pending.configName;
+
+    state.newBackend = "";
+    state.changeBackend[handleId] = false;
+    contextData->canServeWhileChanging = true;
+
+    // Swap in the new feature, the old one is released once it's not in use anymore
+    if (contextData->feature != nullptr && state.currentFeature == contextData->feature.get())
+        state.currentFeature = nullptr;
+
+    contextData->retired.Retire(std::move(contextData->feature), BUFFER_COUNT, retireDelay);
+    contextData->feature = std::move(pending.feature);
+    contextData->feature->ApplyConfigUpdates();
+
+    if (pending.fellBack)
+        ImGui::InsertNotification({ ImGuiToastType::Warning, 10000, "Falling back to FSR 2.1.2" });
+
+    // If this is an OptiScaler fake NVNGX param table, delete it
+    int optiParam = 0;
+
+    if (contextData->createParams->Get("OptiScaler", &optiParam) == NVSDK_NGX_Result_Success && optiParam == 1)
+    {
+        TryDestroyNGXParameters(contextData->createParams, NVNGXProxy::D3D12_DestroyParameters());
     }
 
-    // if initial feature can't be inited
+    contextData->createParams = nullptr;
+
     state.currentFeature = contextData->feature.get();
 
     if (state.currentFG != nullptr && state.activeFgInput == FGInput::Upscaler)
@@ -238,3 +398,260 @@ bool FeatureProvider_Dx12::ChangeFeature(std::string_view upscalerName, ID3D12De
 
     return true;
 }
+
+void FeatureProvider_Dx12::PrewarmTick(ID3D12Device* device, IFeature_Dx12* feature)
+{
+    State& state = State::Instance();
+    Config& cfg = *Config::Instance();
+
+    if (!cfg.UpscalerPrewarm.value_or_default())
+    {
+        _prewarm.Discard();
+        return;
+    }
+
+    if (device == nullptr)
+        return;
+
+    const auto screenWidth = (unsigned int) state.screenWidth;
+    const auto screenHeight = (unsigned int) state.screenHeight;
+    const bool resized =
+        _lastScreenWidth != 0 && (screenWidth != _lastScreenWidth || screenHeight != _lastScreenHeight);
+
+    _lastScreenWidth = screenWidth;
+    _lastScreenHeight = screenHeight;
+
+    if (resized && feature != nullptr && feature->IsInited() &&
+        (screenWidth != feature->DisplayWidth() || screenHeight != feature->DisplayHeight()))
+    {
+        const std::string backend = cfg.Dx12Upscaler.value_or_default();
+        const auto& creationKey = feature->CreationKey();
+
+        // DLSS features are created by the NGX runtime and a backend change creates its own feature.
+        // Game's creation inputs are only known from the key of the current feature.
+        if (backend != "dlss" && backend != "dlssd" && !state.changeBackend[feature->Handle()->Id] &&
+            !creationKey.backend.empty())
+        {
+            FeatureKey key = creationKey;
+            key.device = device;
+            key.backend = backend;
+            key.displayWidth = screenWidth;
+            key.displayHeight = screenHeight;
+
+            // Upscale size follows the display size when the game provided one
+            if (key.upscaleWidth != 0 && creationKey.displayWidth != 0)
+                key.upscaleWidth = (unsigned int) ((uint64_t) creationKey.upscaleWidth * screenWidth /
+                                                   creationKey.displayWidth);
+
+            if (key.upscaleHeight != 0 && creationKey.displayHeight != 0)
+                key.upscaleHeight = (unsigned int) ((uint64_t) creationKey.upscaleHeight * screenHeight /
+                                                    creationKey.displayHeight);
+
+            unsigned int optimalWidth = 0;
+            unsigned int optimalHeight = 0;
+            unsigned int newOptimalWidth = 0;
+            unsigned int newOptimalHeight = 0;
+            float scalingRatio = 0.0f;
+
+            GetOptimalRenderSize(feature->PerfQualityValue(), feature->DisplayWidth(), feature->DisplayHeight(),
+                                 &optimalWidth, &optimalHeight, &scalingRatio);
+            GetOptimalRenderSize(feature->PerfQualityValue(), screenWidth, screenHeight, &newOptimalWidth,
+                                 &newOptimalHeight, &scalingRatio);
+
+            PredictRenderSize(feature->RenderWidth(), feature->RenderHeight(), feature->DisplayWidth(),
+                              feature->DisplayHeight(), optimalWidth, optimalHeight, screenWidth, screenHeight,
+                              newOptimalWidth, newOptimalHeight, &key.renderWidth, &key.renderHeight);
+
+            LOG_DEBUG("Swapchain resized to {}x{}, predicted {} feature render size: {}x{}", screenWidth,
+                      screenHeight, backend, key.renderWidth, key.renderHeight);
+
+            _prewarm.Predict(key);
+        }
+    }
+
+    _prewarm.Tick(
+        [device](const FeatureKey& key)
+        {
+            LOG_INFO("Prewarming {} feature, render: {}x{}, display: {}x{}", key.backend, key.renderWidth,
+                     key.renderHeight, key.displayWidth, key.displayHeight);
+
+            // Handle ids are given out on the game thread
+            const auto handleId = IFeature::GetNextHandleId();
+
+            return std::async(
+                std::launch::async,
+                [device, key, handleId]()
+                {
+                    std::unique_ptr<IFeature_Dx12> result;
+                    std::string configName;
+                    bool fellBack = false;
+
+                    auto params = GetNGXParameters("OptiDx12Prewarm", false);
+                    params->Set(NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, key.featureFlags);
+                    params->Set(NVSDK_NGX_Parameter_Width, key.renderWidth);
+                    params->Set(NVSDK_NGX_Parameter_Height, key.renderHeight);
+                    params->Set(NVSDK_NGX_Parameter_OutWidth, key.displayWidth);
+                    params->Set(NVSDK_NGX_Parameter_OutHeight, key.displayHeight);
+                    params->Set(NVSDK_NGX_Parameter_PerfQualityValue, key.perfQuality);
+
+                    if (key.responsivePixelMask != 0)
+                        params->Set("XeSS.ResponsivePixelMask", key.responsivePixelMask);
+
+                    if (key.upscaleWidth != 0 && key.upscaleHeight != 0)
+                    {
+                        params->Set(OptiKeys::FSR_UpscaleWidth, key.upscaleWidth);
+                        params->Set(OptiKeys::FSR_UpscaleHeight, key.upscaleHeight);
+                    }
+
+                    // A fallback upscaler wouldn't match the game's request
+                    if (GetFeature(key.backend, handleId, params, &result, &configName, &fellBack) &&
+                        configName == key.backend)
+                    {
+                        if (!InitOnWorker(result.get(), device, params))
+                        {
+                            LOG_WARN("Prewarm init failed with {0} feature", key.backend);
+                            result.reset();
+                        }
+                        else
+                        {
+                            result->SetCreationKey(key);
+                        }
+                    }
+                    else
+                    {
+                        result.reset();
+                    }
+
+                    TryDestroyNGXParameters(params, NVNGXProxy::D3D12_DestroyParameters());
+
+                    return result;
+                });
+        });
+}
+
+bool FeatureProvider_Dx12::GetFeatureKey(ID3D12Device* device, std::string_view upscalerName,
+                                         NVSDK_NGX_Parameter* parameters, FeatureKey* key)
+{
+    key->device = device;
+    key->backend = upscalerName;
+
+    if (parameters->Get(NVSDK_NGX_Parameter_Width, &key->renderWidth) != NVSDK_NGX_Result_Success ||
+        parameters->Get(NVSDK_NGX_Parameter_Height, &key->renderHeight) != NVSDK_NGX_Result_Success ||
+        parameters->Get(NVSDK_NGX_Parameter_OutWidth, &key->displayWidth) != NVSDK_NGX_Result_Success ||
+        parameters->Get(NVSDK_NGX_Parameter_OutHeight, &key->displayHeight) != NVSDK_NGX_Result_Success)
+    {
+        return false;
+    }
+
+    parameters->Get(NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, &key->featureFlags);
+    parameters->Get(NVSDK_NGX_Parameter_PerfQualityValue, &key->perfQuality);
+    parameters->Get("XeSS.ResponsivePixelMask", &key->responsivePixelMask);
+    parameters->Get(OptiKeys::FSR_UpscaleWidth, &key->upscaleWidth);
+    parameters->Get(OptiKeys::FSR_UpscaleHeight, &key->upscaleHeight);
+
+    return true;
+}
+
+void FeatureProvider_Dx12::SetCreationKey(IFeature_Dx12* feature, ID3D12Device* device,
+                                          std::string_view upscalerName, NVSDK_NGX_Parameter* parameters)
+{
+    FeatureKey key {};
+
+    // Feature without a key is never pooled
+    if (feature != nullptr && GetFeatureKey(device, upscalerName, parameters, &key))
+        feature->SetCreationKey(key);
+}
+
+std::unique_ptr<IFeature_Dx12> FeatureProvider_Dx12::TakePrewarmed(ID3D12Device* device,
+                                                                   std::string_view upscalerName,
+                                                                   NVSDK_NGX_Parameter* parameters)
+{
+    FeatureKey key {};
+
+    if (!Config::Instance()->UpscalerPrewarm.value_or_default() ||
+        !GetFeatureKey(device, upscalerName, parameters, &key))
+    {
+        return nullptr;
+    }
+
+    auto feature = _prewarm.Take(key);
+
+    if (feature != nullptr)
+    {
+        LOG_INFO("Using prewarmed {} feature, render: {}x{}, display: {}x{}", key.backend, key.renderWidth,
+                 key.renderHeight, key.displayWidth, key.displayHeight);
+
+        // Config updates of the init were deferred on the prewarm worker
+        feature->ApplyConfigUpdates();
+    }
+
+    return feature;
+}
+
+bool FeatureProvider_Dx12::PoolFeature(std::unique_ptr<IFeature_Dx12>& feature)
+{
+    State& state = State::Instance();
+    Config& cfg = *Config::Instance();
+
+    if (feature == nullptr || !feature->IsInited())
+        return false;
+
+    // DLSS features belong to the NGX runtime, a feature in the middle of a backend change is replaced anyway
+    const auto name = feature->Name();
+    if (name == "DLSS" || name == "DLSSD" || state.changeBackend[feature->Handle()->Id])
+        return false;
+
+    // Key is taken at creation, config or feature values might have changed since then
+    const FeatureKey key = feature->CreationKey();
+
+    if (key.device == nullptr || key.backend.empty())
+        return false;
+
+    std::lock_guard<std::mutex> lock(_poolMutex);
+
+    _pool.Configure(PoolCapacity, std::chrono::milliseconds(cfg.UpscalerPoolKeepTime.value_or_default()));
+
+    if (!_pool.Release(key, std::move(feature)))
+        return false;
+
+    LOG_INFO("Keeping released {} feature, render: {}x{}, display: {}x{}", key.backend, key.renderWidth,
+             key.renderHeight, key.displayWidth, key.displayHeight);
+
+    return true;
+}
+
+std::unique_ptr<IFeature_Dx12> FeatureProvider_Dx12::TakePooled(ID3D12Device* device, std::string_view upscalerName,
+                                                                NVSDK_NGX_Parameter* parameters)
+{
+    FeatureKey key {};
+
+    if (!GetFeatureKey(device, upscalerName, parameters, &key))
+        return nullptr;
+
+    std::unique_ptr<IFeature_Dx12> feature;
+
+    {
+        std::lock_guard<std::mutex> lock(_poolMutex);
+
+        if (_pool.Count() == 0)
+            return nullptr;
+
+        feature = _pool.Acquire(key);
+    }
+
+    if (feature != nullptr)
+        LOG_INFO("Reusing released {} feature, render: {}x{}, display: {}x{}", key.backend, key.renderWidth,
+                 key.renderHeight, key.displayWidth, key.displayHeight);
+
+    return feature;
+}
+
+void FeatureProvider_Dx12::CollectPooled()
+{
+    std::lock_guard<std::mutex> lock(_poolMutex);
+
+    if (Config::Instance()->UpscalerPoolKeepTime.value_or_default() <= 0)
+        _pool.Clear();
+    else
+        _pool.Collect();
+}
@@ -1,14 +1,66 @@
 #pragma once
 #include "SysUtils.h"
 #include "IFeature_Dx12.h"
+#include "ContextPrewarm.h"
+#include "FeaturePool.h"
 #include <inputs/NVNGX_DLSS.h>
 
+#include <mutex>
+
 class FeatureProvider_Dx12
 {
   public:
+    using FeatureKey = FeatureKey_Dx12;
+
+    // Released features kept at most, enough for a menu or scene capture handle next to the main one
+    static constexpr size_t PoolCapacity = 2;
+
+  private:
+    inline static ContextPrewarm<FeatureKey, IFeature_Dx12> _prewarm;
+    inline static FeaturePool<FeatureKey, IFeature_Dx12> _pool;
+    inline static std::mutex _poolMutex; // Pool is also collected on present
+    inline static unsigned int _lastScreenWidth = 0;
+    inline static unsigned int _lastScreenHeight = 0;
+
+    static bool GetFeatureKey(ID3D12Device* device, std::string_view upscalerName, NVSDK_NGX_Parameter* parameters,
+                              FeatureKey* key);
+
+  public:
+    // When configName is set the selected upscaler is returned there instead of being saved to the config.
+    // When fellBack is set a failed module load is reported there instead of a notification (worker threads).
     static bool GetFeature(std::string_view upscalerName, UINT handleId, NVSDK_NGX_Parameter* parameters,
-                           std::unique_ptr<IFeature_Dx12>* feature);
+                           std::unique_ptr<IFeature_Dx12>* feature, std::string* configName = nullptr,
+                           bool* fellBack = nullptr);
 
     static bool ChangeFeature(std::string_view upscalerName, ID3D12Device* device, ID3D12GraphicsCommandList* cmdList,
                               UINT handleId, NVSDK_NGX_Parameter* parameters, ContextData<IFeature_Dx12>* contextData);
+
+    // Called once per evaluate, starts building a feature for the new swapchain size after a resize
+    static void PrewarmTick(ID3D12Device* device, IFeature_Dx12* feature);
+
+    // Stores the creation parameters with an initialized feature so it can be pooled later
+    static void SetCreationKey(IFeature_Dx12* feature, ID3D12Device* device, std::string_view upscalerName,
+                               NVSDK_NGX_Parameter* parameters);
+
+    // Returns the prewarmed feature if it was built with these creation parameters, nullptr otherwise
+    static std::unique_ptr<IFeature_Dx12> TakePrewarmed(ID3D12Device* device, std::string_view upscalerName,
+                                                        NVSDK_NGX_Parameter* parameters);
+
+    static void DiscardPrewarmed() { _prewarm.Discard(); }
+
+    // Keeps the feature of a released handle for a while, returns false when it can't be reused
+    static bool PoolFeature(std::unique_ptr<IFeature_Dx12>& feature);
+
+    // Returns a pooled feature created with these parameters, nullptr otherwise
+    static std::unique_ptr<IFeature_Dx12> TakePooled(ID3D12Device* device, std::string_view upscalerName,
+                                                     NVSDK_NGX_Parameter* parameters);
+
+    // Destroys pooled features after their grace period, called on present, evaluate, create and release
+    static void CollectPooled();
+
+    static void ClearPooled()
+    {
+        std::lock_guard<std::mutex> lock(_poolMutex);
+        _pool.Clear();
+    }
 };
@@ -145,11 +145,8 @@ bool FeatureProvider_Vk::ChangeFeature(std::string upscalerName, VkInstance inst
 
             State::Instance().currentFeature = nullptr;
 
-            LOG_DEBUG("sleeping before reset of current feature for 1000ms");
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-
-            contextData->feature.reset();
-            contextData->feature = nullptr;
+            // GPU is idle, only other threads might still hold it so release it later instead of blocking here
+            contextData->retired.Retire(std::move(contextData->feature), 0, std::chrono::milliseconds(1000));
         }
         else
         {
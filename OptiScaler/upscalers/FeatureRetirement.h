@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Keeps replaced upscaler features alive until the GPU and other threads (menu, FG) are done with them.
+// Replaces sleeping on the render thread before releasing the old feature during a backend change.
+template <typename FeatureType> class FeatureRetirement
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  private:
+    struct Entry
+    {
+        std::unique_ptr<FeatureType> feature;
+        uint64_t releaseFrame = 0;
+        Clock::time_point releaseTime {};
+    };
+
+    std::vector<Entry> _entries;
+    uint64_t _frame = 0;
+
+  public:
+    // Released once Collect was called framesToKeep times and minDelay has passed
+    void Retire(std::unique_ptr<FeatureType> feature, uint32_t framesToKeep, std::chrono::milliseconds minDelay,
+                Clock::time_point now = Clock::now())
+    {
+        if (feature == nullptr)
+            return;
+
+        _entries.push_back({ std::move(feature), _frame + framesToKeep, now + minDelay });
+    }
+
+    // Should be called once per frame from the thread which owns the features
+    void Collect(Clock::time_point now = Clock::now())
+    {
+        _frame++;
+
+        if (_entries.empty())
+            return;
+
+        std::erase_if(_entries, [this, now](const Entry& entry)
+                      { return _frame >= entry.releaseFrame && now >= entry.releaseTime; });
+    }
+
+    void Clear() { _entries.clear(); }
+    size_t Count() const { return _entries.size(); }
+};
@@ -2,6 +2,8 @@
 #include <Config.h>
 #include "IFeature.h"
 
+#include <imgui/ImGuiNotify.hpp>
+
 void IFeature::SetHandle(unsigned int InHandleId)
 {
     _handle = new NVSDK_NGX_Handle { InHandleId };
@@ -99,16 +101,8 @@ bool IFeature::SetInitParameters(NVSDK_NGX_Parameter* InParameters)
         LOG_INFO("Init Flag LowResMV: {}", _initFlags.LowResMV);
         LOG_INFO("Init Flag SharpenEnabled: {}", _initFlags.SharpenEnabled);
 
-        if (State::Instance().activeFgInput == FGInput::Upscaler)
-        {
-            Config::Instance()->FGXeFGDepthInverted = _initFlags.DepthInverted;
-            Config::Instance()->FGXeFGJitteredMV = _initFlags.JitteredMV;
-            Config::Instance()->FGXeFGHighResMV = !_initFlags.LowResMV;
-            LOG_DEBUG("XeFG DepthInverted: {}", Config::Instance()->FGXeFGDepthInverted.value_or_default());
-            LOG_DEBUG("XeFG JitteredMV: {}", Config::Instance()->FGXeFGJitteredMV.value_or_default());
-            LOG_DEBUG("XeFG HighResMV: {}", Config::Instance()->FGXeFGHighResMV.value_or_default());
-            Config::Instance()->SaveXeFG();
-        }
+        if (!_deferConfigUpdates)
+            ApplyConfigUpdates();
     }
 
     if (InParameters->Get(NVSDK_NGX_Parameter_OutWidth, &outWidth) == NVSDK_NGX_Result_Success &&
@@ -169,79 +163,89 @@ bool IFeature::SetInitParameters(NVSDK_NGX_Parameter* InParameters)
     return false;
 }
 
+void IFeature::Notify(ImGuiToastType type, const std::string& text)
+{
+    if (_deferConfigUpdates)
+        _deferredNotifications.emplace_back(type, text);
+    else
+        ImGui::InsertNotification({ type, 10000, text.c_str() });
+}
+
+void IFeature::UpdateConfig(std::function<void()> update)
+{
+    if (_deferConfigUpdates)
+        _deferredConfigUpdates.push_back(std::move(update));
+    else
+        update();
+}
+
+void IFeature::ApplyConfigUpdates()
+{
+    _deferConfigUpdates = false;
+
+    for (const auto& update : _deferredConfigUpdates)
+        update();
+
+    _deferredConfigUpdates.clear();
+
+    for (const auto& [type, text] : _deferredNotifications)
+        ImGui::InsertNotification({ type, 10000, text.c_str() });
+
+    _deferredNotifications.clear();
+
+    if (State::Instance().activeFgInput != FGInput::Upscaler)
+        return;
+
+    Config::Instance()->FGXeFGDepthInverted = _initFlags.DepthInverted;
+    Config::Instance()->FGXeFGJitteredMV = _initFlags.JitteredMV;
+    Config::Instance()->FGXeFGHighResMV = !_initFlags.LowResMV;
+    LOG_DEBUG("XeFG DepthInverted: {}", Config::Instance()->FGXeFGDepthInverted.value_or_default());
+    LOG_DEBUG("XeFG JitteredMV: {}", Config::Instance()->FGXeFGJitteredMV.value_or_default());
+    LOG_DEBUG("XeFG HighResMV: {}", Config::Instance()->FGXeFGHighResMV.value_or_default());
+    Config::Instance()->SaveXeFG();
+}
+
 void IFeature::GetRenderResolution(const NVSDK_NGX_Parameter* InParameters, unsigned int* OutWidth,
                                    unsigned int* OutHeight)
 {
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, OutWidth) !=
-            NVSDK_NGX_Result_Success ||
-        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, OutHeight) !=
-            NVSDK_NGX_Result_Success)
+    UpscaleFrameInputs inputs {};
+    UpscaleFrameInputs::ReadRenderSize(InParameters, inputs);
+
+    GetRenderResolution(inputs, OutWidth, OutHeight);
+}
+
+void IFeature::GetRenderResolution(const UpscaleFrameInputs& InInputs, unsigned int* OutWidth,
+                                   unsigned int* OutHeight)
+{
+    if (InInputs.RenderWidth > 0 && InInputs.RenderHeight > 0)
+    {
+        *OutWidth = InInputs.RenderWidth;
+        *OutHeight = InInputs.RenderHeight;
+    }
+    else
     {
         LOG_WARN("No subrect dimension info!");
 
-        unsigned int width;
-        unsigned int height;
-        unsigned int outWidth;
-        unsigned int outHeight;
-
-        do
+        if (InInputs.InputWidth > 0 && InInputs.InputHeight > 0)
         {
-            if (InParameters->Get(NVSDK_NGX_Parameter_Width, &width) == NVSDK_NGX_Result_Success &&
-                InParameters->Get(NVSDK_NGX_Parameter_Height, &height) == NVSDK_NGX_Result_Success)
-            {
-                if (InParameters->Get(NVSDK_NGX_Parameter_OutWidth, &outWidth) == NVSDK_NGX_Result_Success &&
-                    InParameters->Get(NVSDK_NGX_Parameter_OutHeight, &outHeight) == NVSDK_NGX_Result_Success)
-                {
-                    if (width < outWidth)
-                    {
-                        *OutWidth = width;
-                        *OutHeight = height;
-                        break;
-                    }
-
-                    *OutWidth = outWidth;
-                    *OutHeight = outHeight;
-                }
-                else
-                {
-                    if (width < RenderWidth())
-                    {
-                        *OutWidth = width;
-                        *OutHeight = height;
-                        break;
-                    }
-
-                    *OutWidth = RenderWidth();
-                    *OutHeight = RenderHeight();
-                    return;
-                }
-            }
+            auto maxWidth = InInputs.OutputWidth > 0 ? InInputs.OutputWidth : RenderWidth();
+            auto maxHeight = InInputs.OutputWidth > 0 ? InInputs.OutputHeight : RenderHeight();
 
+            *OutWidth = InInputs.InputWidth < maxWidth ? InInputs.InputWidth : maxWidth;
+            *OutHeight = InInputs.InputWidth < maxWidth ? InInputs.InputHeight : maxHeight;
+        }
+        else
+        {
             *OutWidth = RenderWidth();
             *OutHeight = RenderHeight();
-
-        } while (false);
+        }
     }
 
     _renderWidth = *OutWidth;
     _renderHeight = *OutHeight;
 
-    // Should not be needed but who knows
-    // if (_renderHeight == _displayHeight && _renderWidth == _displayWidth && _perfQualityValue !=
-    // NVSDK_NGX_PerfQuality_Value_DLAA)
-    //{
-    //	InParameters->Set(NVSDK_NGX_Parameter_PerfQualityValue, 5);
-    //	InParameters->Set(NVSDK_NGX_Parameter_Scale, 1.0f);
-    //	InParameters->Set(NVSDK_NGX_Parameter_SuperSampling_ScaleFactor, 1.0f);
-    // }
-
-    JitterInfo ji {};
-    if (_jitterInfo.size() < 350 &&
-        InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &ji.x) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &ji.y) == NVSDK_NGX_Result_Success)
-    {
-        _jitterInfo.insert(std::make_pair(ji.x, ji.y));
-    }
+    if (_jitterInfo.size() < 350)
+        _jitterInfo.insert(std::make_pair(InInputs.JitterX, InInputs.JitterY));
 }
 
 float IFeature::GetSharpness(const NVSDK_NGX_Parameter* InParameters)
@@ -262,6 +266,20 @@ float IFeature::GetSharpness(const NVSDK_NGX_Parameter* InParameters)
     return sharpness;
 }
 
+float IFeature::GetSharpness(const UpscaleFrameInputs& InInputs)
+{
+    if (Config::Instance()->OverrideSharpness.value_or_default())
+        return Config::Instance()->Sharpness.value_or_default();
+
+    if (InInputs.Sharpness < 0.0f)
+        return 0.0f;
+
+    if (InInputs.Sharpness > 1.0f)
+        return 1.0f;
+
+    return InInputs.Sharpness;
+}
+
 void IFeature::TickFrozenCheck()
 {
     static long updatesWithoutFramecountChange = 0;
@@ -290,6 +308,16 @@ bool IFeature::UpdateOutputResolution(const NVSDK_NGX_Parameter* InParameters)
     InParameters->Get("FSR.upscaleSize.width", &fsrDynamicOutputWidth);
     InParameters->Get("FSR.upscaleSize.height", &fsrDynamicOutputHeight);
 
+    return UpdateOutputResolution(fsrDynamicOutputWidth, fsrDynamicOutputHeight);
+}
+
+bool IFeature::UpdateOutputResolution(const UpscaleFrameInputs& InInputs)
+{
+    return UpdateOutputResolution((int) InInputs.UpscaleWidth, (int) InInputs.UpscaleHeight);
+}
+
+bool IFeature::UpdateOutputResolution(int fsrDynamicOutputWidth, int fsrDynamicOutputHeight)
+{
     if (Config::Instance()->OutputScalingEnabled.value_or_default())
     {
         if (_targetWidth == fsrDynamicOutputWidth || _targetHeight == fsrDynamicOutputHeight)
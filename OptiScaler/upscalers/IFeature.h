@@ -4,11 +4,17 @@
 #include <nvsdk_ngx.h>
 #include <nvsdk_ngx_defs.h>
 
+#include <functional>
 #include <unordered_set>
+#include <vector>
 #include <Util.h>
 
+#include "UpscaleFrameInputs.h"
+
 #define DLSS_MOD_ID_OFFSET 1000000
 
+enum class ImGuiToastType : uint8_t;
+
 inline static unsigned int handleCounter = DLSS_MOD_ID_OFFSET;
 
 struct InitFlags
@@ -48,6 +54,8 @@ class IFeature
 
     std::unordered_set<std::pair<float, float>, hashFunction> _jitterInfo;
 
+    bool UpdateOutputResolution(int upscaleWidth, int upscaleHeight);
+
   protected:
     // D3D11with12
     inline static ID3D12Device* _dx11on12Device = nullptr;
@@ -75,12 +83,23 @@ class IFeature
     long _frameCount = 0;
     bool _featureFrozen = false;
     bool _moduleLoaded = false;
+    bool _deferConfigUpdates = false;
+    std::vector<std::pair<ImGuiToastType, std::string>> _deferredNotifications;
+    std::vector<std::function<void()>> _deferredConfigUpdates;
 
     void SetHandle(unsigned int InHandleId);
     bool SetInitParameters(NVSDK_NGX_Parameter* InParameters);
     void GetRenderResolution(const NVSDK_NGX_Parameter* InParameters, unsigned int* OutWidth, unsigned int* OutHeight);
+    void GetRenderResolution(const UpscaleFrameInputs& InInputs, unsigned int* OutWidth, unsigned int* OutHeight);
     void GetDynamicOutputResolution(NVSDK_NGX_Parameter* InParameters, unsigned int* width, unsigned int* height);
     float GetSharpness(const NVSDK_NGX_Parameter* InParameters);
+    float GetSharpness(const UpscaleFrameInputs& InInputs);
+
+    // Shows a notification, features inited on a worker keep it for ApplyConfigUpdates
+    void Notify(ImGuiToastType type, const std::string& text);
+
+    // Writes config right away, features inited on a worker keep the write for ApplyConfigUpdates
+    void UpdateConfig(std::function<void()> update);
 
     virtual void SetInit(bool InValue) { _isInited = InValue; }
 
@@ -98,6 +117,7 @@ class IFeature
     void TickFrozenCheck();
     bool IsFrozen() const { return _featureFrozen; };
     bool UpdateOutputResolution(const NVSDK_NGX_Parameter* InParameters);
+    bool UpdateOutputResolution(const UpscaleFrameInputs& InInputs);
     unsigned int DisplayWidth() const { return _displayWidth; };
     unsigned int DisplayHeight() const { return _displayHeight; };
     unsigned int TargetWidth() const { return _targetWidth; };
@@ -125,6 +145,16 @@ class IFeature
     bool LowResMV() { return _initFlags.LowResMV; }
     bool SharpenEnabled() { return _initFlags.SharpenEnabled; }
 
+    // Features inited on a worker leave config updates and notifications to ApplyConfigUpdates on the game thread
+    void DeferConfigUpdates() { _deferConfigUpdates = true; }
+    void ApplyConfigUpdates();
+
+    // Notifications kept on the worker, for showing them when the feature is dropped after a failed init
+    std::vector<std::pair<ImGuiToastType, std::string>> TakeNotifications()
+    {
+        return std::exchange(_deferredNotifications, {});
+    }
+
     IFeature(unsigned int InHandleId, NVSDK_NGX_Parameter* InParameters) { SetHandle(InHandleId); }
 
     virtual ~IFeature() {}
@@ -250,8 +250,68 @@ bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11
     return true;
 }
 
+bool IFeature_Dx11wDx12::OpenSharedResource(D3D11_TEXTURE2D_RESOURCE_C* InResource, const char* InName)
+{
+    // Same handle as last frame, Dx12 resource is still valid
+    if (InResource->Dx12Handle == InResource->Dx11Handle && InResource->Dx12Resource != nullptr)
+        return true;
+
+    if (InResource->Dx12Handle != NULL && InResource->Dx12Handle != InResource->Dx11Handle &&
+        (InResource->Desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED_NTHANDLE))
+    {
+        CloseHandle(InResource->Dx12Handle);
+    }
+
+    if (InResource->Dx12Resource != nullptr)
+    {
+        // Last used by previous frame which signals _frameCount
+        _retiredResources.push_back({ static_cast<UINT64>(_frameCount), InResource->Dx12Resource });
+        InResource->Dx12Resource = nullptr;
+    }
+
+    auto result = _dx11on12Device->OpenSharedHandle(InResource->Dx11Handle, IID_PPV_ARGS(&InResource->Dx12Resource));
+
+    if (result != S_OK)
+    {
+        LOG_ERROR("{} OpenSharedHandle error: {:X}", InName, (UINT) result);
+        InResource->Dx12Handle = NULL;
+        return false;
+    }
+
+    LOG_DEBUG("{} opened shared handle: {:X}", InName, (size_t) InResource->Dx11Handle);
+    InResource->Dx12Handle = InResource->Dx11Handle;
+
+    return true;
+}
+
+void IFeature_Dx11wDx12::ReleaseRetiredResources(bool InForce)
+{
+    if (_retiredResources.empty())
+        return;
+
+    UINT64 completed = 0;
+
+    if (!InForce && Dx12Fence != nullptr)
+        completed = Dx12Fence->GetCompletedValue();
+
+    for (size_t i = 0; i < _retiredResources.size();)
+    {
+        if (InForce || _retiredResources[i].first <= completed)
+        {
+            _retiredResources[i].second->Release();
+            _retiredResources[i] = _retiredResources.back();
+            _retiredResources.pop_back();
+            continue;
+        }
+
+        i++;
+    }
+}
+
 void IFeature_Dx11wDx12::ReleaseSharedResources()
 {
+    ReleaseRetiredResources(true);
+
     SAFE_RELEASE(dx11Color.SharedTexture);
     SAFE_RELEASE(dx11Mv.SharedTexture);
     SAFE_RELEASE(dx11Out.SharedTexture);
@@ -267,11 +327,13 @@ void IFeature_Dx11wDx12::ReleaseSharedResources()
 
     ReleaseSyncResources();
 
-    SAFE_RELEASE(Dx12CommandList[0]);
-    SAFE_RELEASE(Dx12CommandList[1]);
+    for (size_t i = 0; i < InteropRingSize; i++)
+    {
+        SAFE_RELEASE(Dx12CommandList[i]);
+        SAFE_RELEASE(Dx12CommandAllocator[i]);
+    }
+
     SAFE_RELEASE(Dx12CommandQueue);
-    SAFE_RELEASE(Dx12CommandAllocator[0]);
-    SAFE_RELEASE(Dx12CommandAllocator[1]);
     SAFE_RELEASE(Dx12Fence);
 
     if (Dx12FenceEvent)
@@ -341,7 +403,7 @@ HRESULT IFeature_Dx11wDx12::CreateDx12Device(D3D_FEATURE_LEVEL InFeatureLevel)
         if (hwAdapter != nullptr)
         {
             DXGI_ADAPTER_DESC desc {};
-            auto primaryGpu = IdentifyGpu::getPrimaryGpu();
+            const auto& primaryGpu = IdentifyGpu::getPrimaryGpu();
             if (hwAdapter->GetDesc(&desc) == S_OK && !IsEqualLUID(desc.AdapterLuid, primaryGpu.luid))
             {
                 LOG_WARN("D3D12Device created with non-primary GPU");
@@ -379,7 +441,7 @@ HRESULT IFeature_Dx11wDx12::CreateDx12Device(D3D_FEATURE_LEVEL InFeatureLevel)
         }
     }
 
-    for (size_t i = 0; i < 2; i++)
+    for (size_t i = 0; i < InteropRingSize; i++)
     {
         if (Dx12CommandAllocator[i] == nullptr)
         {
@@ -435,10 +497,14 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
 {
     HRESULT result;
 
-    // Wait for last frame
-    if (Dx12Fence->GetCompletedValue() < _frameCount)
+    // Only wait when Dx12 side is a full ring behind, shared textures are synced on gpu with shared fence
+    auto waitValue = InteropWaitValue();
+
+    if (waitValue > 0 && Dx12Fence->GetCompletedValue() < waitValue)
     {
-        result = Dx12Fence->SetEventOnCompletion(_frameCount, Dx12FenceEvent);
+        LOG_DEBUG("Waiting for ring slot, frame: {}, waitValue: {}", _frameCount, waitValue);
+
+        result = Dx12Fence->SetEventOnCompletion(waitValue, Dx12FenceEvent);
         if (result != S_OK)
         {
             LOG_ERROR("SetEventOnCompletion error: {:X}", (UINT) result);
@@ -448,7 +514,9 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
         WaitForSingleObject(Dx12FenceEvent, INFINITE);
     }
 
-    auto frame = _frameCount % 2;
+    ReleaseRetiredResources(false);
+
+    auto frame = InteropFrameIndex();
 
     result = Dx12CommandAllocator[frame]->Reset();
     if (result != S_OK)
@@ -646,107 +714,31 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
 
     LOG_DEBUG("SharedHandles start!");
 
-    if (paramColor && dx11Color.Dx12Handle != dx11Color.Dx11Handle)
-    {
-        if (dx11Color.Dx12Handle != NULL)
-            CloseHandle(dx11Color.Dx12Handle);
-
-        result = _dx11on12Device->OpenSharedHandle(dx11Color.Dx11Handle, IID_PPV_ARGS(&dx11Color.Dx12Resource));
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("Color OpenSharedHandle error: {0:x}", result);
-            return false;
-        }
-
-        dx11Color.Dx12Handle = dx11Color.Dx11Handle;
-    }
-
-    if (paramMv && dx11Mv.Dx12Handle != dx11Mv.Dx11Handle)
-    {
-        if (dx11Mv.Dx12Handle != NULL)
-            CloseHandle(dx11Mv.Dx12Handle);
-
-        result = _dx11on12Device->OpenSharedHandle(dx11Mv.Dx11Handle, IID_PPV_ARGS(&dx11Mv.Dx12Resource));
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("MotionVectors OpenSharedHandle error: {0:x}", result);
-            return false;
-        }
-
-        dx11Mv.Dx11Handle = dx11Mv.Dx12Handle;
-    }
-
-    if (paramOutput[_frameCount % 2] && dx11Out.Dx12Handle != dx11Out.Dx11Handle)
-    {
-        if (dx11Out.Dx12Handle != NULL)
-            CloseHandle(dx11Out.Dx12Handle);
-
-        result = _dx11on12Device->OpenSharedHandle(dx11Out.Dx11Handle, IID_PPV_ARGS(&dx11Out.Dx12Resource));
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("Output OpenSharedHandle error: {0:x}", result);
-            return false;
-        }
-
-        dx11Out.Dx12Handle = dx11Out.Dx11Handle;
-    }
-
-    if (paramDepth && dx11Depth.Dx12Handle != dx11Depth.Dx11Handle)
-    {
-        if (dx11Depth.Dx12Handle != NULL)
-            CloseHandle(dx11Depth.Dx12Handle);
-
-        result = _dx11on12Device->OpenSharedHandle(dx11Depth.Dx11Handle, IID_PPV_ARGS(&dx11Depth.Dx12Resource));
+    if (paramColor && !OpenSharedResource(&dx11Color, "Color"))
+        return false;
 
-        if (result != S_OK)
-        {
-            LOG_ERROR("Depth OpenSharedHandle error: {0:x}", result);
-            return false;
-        }
+    if (paramMv && !OpenSharedResource(&dx11Mv, "MotionVectors"))
+        return false;
 
-        auto desc = dx11Depth.Dx12Resource->GetDesc();
+    if (paramOutput[_frameCount % 2] && !OpenSharedResource(&dx11Out, "Output"))
+        return false;
 
-        dx11Depth.Dx12Handle = dx11Depth.Dx11Handle;
-    }
+    if (paramDepth && !OpenSharedResource(&dx11Depth, "Depth"))
+        return false;
 
     if (AutoExposure())
     {
         LOG_DEBUG("AutoExposure enabled!");
     }
-    else if (paramExposure && dx11Exp.Dx12Handle != dx11Exp.Dx11Handle)
+    else if (paramExposure && !OpenSharedResource(&dx11Exp, "ExposureTexture"))
     {
-        if (dx11Exp.Dx12Handle != NULL)
-            CloseHandle(dx11Exp.Dx12Handle);
-
-        result = _dx11on12Device->OpenSharedHandle(dx11Exp.Dx11Handle, IID_PPV_ARGS(&dx11Exp.Dx12Resource));
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("ExposureTexture OpenSharedHandle error: {0:x}", result);
-            return false;
-        }
-
-        dx11Exp.Dx12Handle = dx11Exp.Dx11Handle;
+        return false;
     }
 
     if (!Config::Instance()->DisableReactiveMask.value_or(false) && paramReactiveMask &&
-        dx11Reactive.Dx12Handle != dx11Reactive.Dx11Handle)
+        !OpenSharedResource(&dx11Reactive, "TransparencyMask"))
     {
-        if (dx11Reactive.Dx12Handle != NULL)
-            CloseHandle(dx11Reactive.Dx12Handle);
-
-        result = _dx11on12Device->OpenSharedHandle(dx11Reactive.Dx11Handle, IID_PPV_ARGS(&dx11Reactive.Dx12Resource));
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("TransparencyMask OpenSharedHandle error: {0:x}", result);
-            return false;
-        }
-
-        dx11Reactive.Dx12Handle = dx11Reactive.Dx11Handle;
+        return false;
     }
 
 #pragma endregion
@@ -41,9 +41,13 @@ class IFeature_Dx11wDx12 : public virtual IFeature_Dx11
 
     D3D12_COMMAND_LIST_TYPE Dx12CommandListType = D3D12_COMMAND_LIST_TYPE_DIRECT;
 
+    // Number of frames Dx12 side can be behind the Dx11 side before CPU needs to wait for an allocator.
+    // Gpu side ordering is handled with shared fence Signal/Wait calls so shared textures don't need a ring.
+    static constexpr size_t InteropRingSize = 3;
+
     ID3D12CommandQueue* Dx12CommandQueue = nullptr;
-    ID3D12CommandAllocator* Dx12CommandAllocator[2] = { nullptr, nullptr };
-    ID3D12GraphicsCommandList* Dx12CommandList[2] = { nullptr, nullptr };
+    ID3D12CommandAllocator* Dx12CommandAllocator[InteropRingSize] = {};
+    ID3D12GraphicsCommandList* Dx12CommandList[InteropRingSize] = {};
     ID3D12Fence* Dx12Fence = nullptr;
     HANDLE Dx12FenceEvent = nullptr;
 
@@ -56,6 +60,9 @@ class IFeature_Dx11wDx12 : public virtual IFeature_Dx11
 
     ID3D11Resource* paramOutput[2] = { nullptr, nullptr };
 
+    // Dx12 resources replaced while previous frames might still be using them, released after Dx12Fence passes
+    std::vector<std::pair<UINT64, ID3D12Resource*>> _retiredResources;
+
     ID3D11Fence* dx11FenceTextureCopy = nullptr;
     ID3D12Fence* dx12FenceTextureCopy = nullptr;
     HANDLE dx11SHForTextureCopy = nullptr;
@@ -68,6 +75,21 @@ class IFeature_Dx11wDx12 : public virtual IFeature_Dx11
 
     HRESULT CreateDx12Device(D3D_FEATURE_LEVEL InFeatureLevel);
 
+    size_t InteropFrameIndex() const { return static_cast<size_t>(_frameCount) % InteropRingSize; }
+
+    // Dx12Fence is signaled with _frameCount + 1 at the end of each frame,
+    // returns the value which must be reached before current ring slot can be reused (0 means no wait)
+    UINT64 InteropWaitValue() const
+    {
+        if (_frameCount < static_cast<long>(InteropRingSize))
+            return 0;
+
+        return static_cast<UINT64>(_frameCount) - InteropRingSize + 1;
+    }
+
+    bool OpenSharedResource(D3D11_TEXTURE2D_RESOURCE_C* InResource, const char* InName);
+    void ReleaseRetiredResources(bool InForce);
+
     bool CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11_TEXTURE2D_RESOURCE_C* OutResource, bool InCopy,
                                bool InDepth, bool InDontUseNTShared);
     bool ProcessDx11Textures(const NVSDK_NGX_Parameter* InParameters);
@@ -8,6 +8,9 @@ void IFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID
     if (InBeforeState == InAfterState)
         return;
 
+    if (BarrierBatch_Dx12::Transition(InCommandList, InResource, InBeforeState, InAfterState))
+        return;
+
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Transition.pResource = InResource;
@@ -1,6 +1,7 @@
 #pragma once
 #include <d3d12.h>
 #include "IFeature.h"
+#include "FeatureKey_Dx12.h"
 
 #include "SysUtils.h"
 #include <Util.h>
@@ -17,6 +18,7 @@ class IFeature_Dx12 : public virtual IFeature
     std::unique_ptr<OS_Dx12> OutputScaler = nullptr;
     std::unique_ptr<RCAS_Dx12> RCAS = nullptr;
     std::unique_ptr<Bias_Dx12> Bias = nullptr;
+    FeatureKey_Dx12 _creationKey {};
 
     void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                          D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState) const;
@@ -26,6 +28,13 @@ class IFeature_Dx12 : public virtual IFeature
                       NVSDK_NGX_Parameter* InParameters) = 0;
     virtual bool Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_NGX_Parameter* InParameters) = 0;
 
+    // Backend reads the typed frame inputs instead of the parameter map
+    virtual bool UsesFrameInputs() const { return false; }
+
+    // Set once the feature is initialized, empty backend when it was never set
+    const FeatureKey_Dx12& CreationKey() const { return _creationKey; }
+    void SetCreationKey(const FeatureKey_Dx12& key) { _creationKey = key; }
+
     IFeature_Dx12(unsigned int InHandleId, NVSDK_NGX_Parameter* InParameters);
 
     ~IFeature_Dx12();
@@ -312,6 +312,13 @@ bool IFeature_VkwDx12::LoadVulkanExternalMemoryFunctions()
             (PFN_vkImportSemaphoreWin32HandleKHR) VulkanGDPA(VulkanDevice, "vkImportSemaphoreWin32HandleKHR");
     }
 
+    // Only needed for aliasing exported game images, not required
+    if (vkGetMemoryWin32HandleKHR == nullptr && VulkanGDPA != nullptr)
+    {
+        vkGetMemoryWin32HandleKHR =
+            (PFN_vkGetMemoryWin32HandleKHR) VulkanGDPA(VulkanDevice, "vkGetMemoryWin32HandleKHR");
+    }
+
     bool result = vkGetMemoryWin32HandlePropertiesKHR != nullptr && vkImportSemaphoreWin32HandleKHR != nullptr;
 
     if (!result)
@@ -616,6 +623,118 @@ bool IFeature_VkwDx12::CreateSharedTexture(const VkImageCreateInfo& ImageInfo, V
     return true;
 }
 
+void IFeature_VkwDx12::ReleaseSharedTexture(VK_TEXTURE2D_RESOURCE_C* InResource)
+{
+    if (InResource->VkSharedImage != VK_NULL_HANDLE)
+    {
+        vkDestroyImage(VulkanDevice, InResource->VkSharedImage, nullptr);
+        InResource->VkSharedImage = VK_NULL_HANDLE;
+    }
+
+    if (InResource->VkSharedImageView != VK_NULL_HANDLE)
+    {
+        vkDestroyImageView(VulkanDevice, InResource->VkSharedImageView, nullptr);
+        InResource->VkSharedImageView = VK_NULL_HANDLE;
+    }
+
+    if (InResource->VkSharedMemory != VK_NULL_HANDLE)
+    {
+        vkFreeMemory(VulkanDevice, InResource->VkSharedMemory, nullptr);
+        InResource->VkSharedMemory = VK_NULL_HANDLE;
+    }
+
+    if (InResource->SharedHandle != NULL)
+    {
+        CloseHandle(InResource->SharedHandle);
+        InResource->SharedHandle = NULL;
+    }
+
+    if (InResource->Dx12Resource != nullptr)
+    {
+        InResource->Dx12Resource->Release();
+        InResource->Dx12Resource = nullptr;
+    }
+
+    InResource->Aliased = false;
+}
+
+bool IFeature_VkwDx12::TryAliasVkImage(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Resource_VK* InParam,
+                                       VK_TEXTURE2D_RESOURCE_C* OutResource, bool InDepth)
+{
+    if (vkGetMemoryWin32HandleKHR == nullptr)
+        return false;
+
+    auto image = InParam->Resource.ImageViewInfo.Image;
+
+    VkInterop::ImageInfo info {};
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+
+    if (!Vulkan_wDx12::GetExternalImageInfo(image, &info, &memory))
+        return false;
+
+    info.HasDxgiFormat = VkFormatToDxgiFormat(info.Format) != DXGI_FORMAT_UNKNOWN;
+
+    if (VkInterop::GetImportMode(info, false, InDepth) != VkInterop::ImportMode::Alias)
+        return false;
+
+    if (!OutResource->Aliased || OutResource->VkSourceImage != image || OutResource->Dx12Resource == nullptr)
+    {
+        ReleaseSharedTexture(OutResource);
+
+        VkMemoryGetWin32HandleInfoKHR handleInfo {};
+        handleInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR;
+        handleInfo.memory = memory;
+        handleInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D12_RESOURCE_BIT;
+
+        HANDLE handle = NULL;
+        auto vkResult = vkGetMemoryWin32HandleKHR(VulkanDevice, &handleInfo, &handle);
+
+        if (vkResult != VK_SUCCESS || handle == NULL)
+        {
+            LOG_WARN("vkGetMemoryWin32HandleKHR error: {}, falling back to copy", magic_enum::enum_name(vkResult));
+            return false;
+        }
+
+        auto hr = _dx11on12Device->OpenSharedHandle(handle, IID_PPV_ARGS(&OutResource->Dx12Resource));
+        CloseHandle(handle);
+
+        if (hr != S_OK)
+        {
+            LOG_WARN("OpenSharedHandle error: {:X}, falling back to copy", (UINT) hr);
+            OutResource->Dx12Resource = nullptr;
+            return false;
+        }
+
+        ASSIGN_VK_DESC((*OutResource), (*OutResource), InParam->Resource.ImageViewInfo.Width,
+                       InParam->Resource.ImageViewInfo.Height, InParam->Resource.ImageViewInfo.Format);
+
+        OutResource->Aliased = true;
+
+        LOG_INFO("Aliasing image {:X} ({}x{}, {}) without copy", (size_t) image, OutResource->Width,
+                 OutResource->Height, magic_enum::enum_name(OutResource->Format));
+    }
+
+    // D3D12 side reads the memory directly, move it to general and CopyBackOutput will restore it
+    VkImageMemoryBarrier imageBarrier = {};
+    imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    imageBarrier.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    imageBarrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    imageBarrier.image = image;
+    imageBarrier.subresourceRange = InParam->Resource.ImageViewInfo.SubresourceRange;
+    imageBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    imageBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+
+    vkCmdPipelineBarrier(InCmdBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                         nullptr, 0, nullptr, 1, &imageBarrier);
+
+    OutResource->VkSourceImageLayout = imageBarrier.newLayout;
+    OutResource->VkSourceImageAccess = imageBarrier.dstAccessMask;
+
+    return true;
+}
+
 bool IFeature_VkwDx12::CopyTextureFromVkToDx12(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Resource_VK* InParam,
                                                VK_TEXTURE2D_RESOURCE_C* OutResource, ResourceCopy_Vk* InCopyShader,
                                                bool InCopy, bool InDepth)
@@ -632,41 +751,20 @@ bool IFeature_VkwDx12::CopyTextureFromVkToDx12(VkCommandBuffer InCmdBuffer, NVSD
     // Check if this is a depth format
     bool isDepthFormat = InDepth; // IsDepthFormat(InParam->Resource.ImageViewInfo.Format);
 
+    // Game image is already shareable, skip our shared texture and the copy
+    if (InCopy && Config::Instance()->VulkanAliasInputs.value_or_default() &&
+        TryAliasVkImage(InCmdBuffer, InParam, OutResource, isDepthFormat))
+    {
+        return true;
+    }
+
     // Check if we need to create a new shared resource
     if (OutResource->Width != InParam->Resource.ImageViewInfo.Width ||
         OutResource->Height != InParam->Resource.ImageViewInfo.Height ||
         OutResource->Format != InParam->Resource.ImageViewInfo.Format || OutResource->VkSharedImage == VK_NULL_HANDLE)
     {
         // Cleanup existing resources
-        if (OutResource->VkSharedImage != VK_NULL_HANDLE)
-        {
-            vkDestroyImage(VulkanDevice, OutResource->VkSharedImage, nullptr);
-            OutResource->VkSharedImage = VK_NULL_HANDLE;
-        }
-
-        if (OutResource->VkSharedImageView != VK_NULL_HANDLE)
-        {
-            vkDestroyImageView(VulkanDevice, OutResource->VkSharedImageView, nullptr);
-            OutResource->VkSharedImageView = VK_NULL_HANDLE;
-        }
-
-        if (OutResource->VkSharedMemory != VK_NULL_HANDLE)
-        {
-            vkFreeMemory(VulkanDevice, OutResource->VkSharedMemory, nullptr);
-            OutResource->VkSharedMemory = VK_NULL_HANDLE;
-        }
-
-        if (OutResource->SharedHandle != NULL)
-        {
-            CloseHandle(OutResource->SharedHandle);
-            OutResource->SharedHandle = NULL;
-        }
-
-        if (OutResource->Dx12Resource != nullptr)
-        {
-            OutResource->Dx12Resource->Release();
-            OutResource->Dx12Resource = nullptr;
-        }
+        ReleaseSharedTexture(OutResource);
 
         ASSIGN_VK_DESC((*OutResource), (*OutResource), InParam->Resource.ImageViewInfo.Width,
                        InParam->Resource.ImageViewInfo.Height, InParam->Resource.ImageViewInfo.Format);
@@ -1529,7 +1627,7 @@ bool IFeature_VkwDx12::CopyBackOutput()
                 imageBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
                 imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
                 imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                imageBarrier.image = resource->VkSharedImage;
+                imageBarrier.image = resource->Aliased ? resource->VkSourceImage : resource->VkSharedImage;
                 imageBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
                 imageBarrier.subresourceRange.baseMipLevel = 0;
                 imageBarrier.subresourceRange.levelCount = 1;
@@ -1969,7 +2067,7 @@ HRESULT IFeature_VkwDx12::CreateDx12Device()
         if (hwAdapter != nullptr)
         {
             DXGI_ADAPTER_DESC desc {};
-            auto primaryGpu = IdentifyGpu::getPrimaryGpu();
+            const auto& primaryGpu = IdentifyGpu::getPrimaryGpu();
             if (hwAdapter->GetDesc(&desc) == S_OK && !IsEqualLUID(desc.AdapterLuid, primaryGpu.luid))
             {
                 LOG_WARN("D3D12Device created with non-primary GPU");
@@ -47,6 +47,7 @@ class IFeature_VkwDx12 : public virtual IFeature_Vk
         VkDeviceMemory VkSharedMemory = VK_NULL_HANDLE;
         ID3D12Resource* Dx12Resource = nullptr;
         HANDLE SharedHandle = NULL;
+        bool Aliased = false; // Dx12Resource is opened from source image memory, no shared image
     };
 
     // Vulkan context - renamed to avoid conflicts
@@ -101,6 +102,7 @@ class IFeature_VkwDx12 : public virtual IFeature_Vk
     // Vulkan function pointers for external memory
     PFN_vkGetMemoryWin32HandlePropertiesKHR vkGetMemoryWin32HandlePropertiesKHR = nullptr;
     PFN_vkImportSemaphoreWin32HandleKHR vkImportSemaphoreWin32HandleKHR = nullptr;
+    PFN_vkGetMemoryWin32HandleKHR vkGetMemoryWin32HandleKHR = nullptr;
 
     // Helper methods
     HRESULT CreateDx12Device();
@@ -110,6 +112,9 @@ class IFeature_VkwDx12 : public virtual IFeature_Vk
     bool CopyTextureFromVkToDx12(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Resource_VK* InParam,
                                  VK_TEXTURE2D_RESOURCE_C* OutResource, ResourceCopy_Vk* InCopyShader, bool InCopy,
                                  bool InDepth);
+    bool TryAliasVkImage(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Resource_VK* InParam,
+                         VK_TEXTURE2D_RESOURCE_C* OutResource, bool InDepth);
+    void ReleaseSharedTexture(VK_TEXTURE2D_RESOURCE_C* InResource);
     bool ProcessVulkanTextures(VkCommandBuffer InCmdList, const NVSDK_NGX_Parameter* InParameters);
     bool CopyBackOutput();
 
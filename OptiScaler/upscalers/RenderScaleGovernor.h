@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Config.h>
+#include <misc/DrsGovernor.h>
+
+#include <algorithm>
+#include <atomic>
+
+// Feeds game frame times to DrsGovernor and reports the DRS limits of the optimal settings queries from it. Maximum is
+// the governed size so the game's DRS can't go above it, minimum is the lower end of the configured range.
+// Optimal size stays with the quality mode so games re-querying it don't recreate their features.
+// Scale never goes above 1.0 so the size always fits into the contexts created for the display resolution.
+class RenderScaleGovernor
+{
+    inline static DrsGovernor _governor;
+    inline static std::atomic<float> _scale = 1.0f;
+    inline static std::atomic<bool> _active = false;
+
+  public:
+    static bool Active() { return _active.load(std::memory_order_acquire); }
+
+    // Called once per game frame on present
+    static void FrameTime(double frameTime)
+    {
+        auto config = Config::Instance();
+
+        if (!config->DrsGovernorEnabled.value_or_default())
+        {
+            if (_active.exchange(false, std::memory_order_acq_rel))
+            {
+                _governor.Reset();
+                _scale.store(1.0f, std::memory_order_release);
+            }
+
+            return;
+        }
+
+        auto minRatio = std::max(config->DrsGovernorMinRatio.value_or_default(), 1.0f);
+        auto maxRatio = std::max(config->DrsGovernorMaxRatio.value_or_default(), minRatio);
+        auto targetFps = std::max(config->DrsGovernorTargetFps.value_or_default(), 1.0f);
+
+        auto settings = _governor.GetSettings();
+        settings.targetFrameTime = 1000.0 / targetFps;
+        settings.minScale = 1.0f / maxRatio;
+        settings.maxScale = 1.0f / minRatio;
+        _governor.Configure(settings);
+
+        if (!_active.exchange(true, std::memory_order_acq_rel))
+            _governor.Reset();
+
+        _scale.store(_governor.Update(frameTime), std::memory_order_release);
+    }
+
+    // Scale the governor picked for the target frame rate
+    static float Scale() { return _scale.load(std::memory_order_acquire); }
+
+    // DRS limits for the display size, maximum follows the governed scale inside the configured ratios
+    static void Range(unsigned int displayWidth, unsigned int displayHeight, unsigned int& minWidth,
+                      unsigned int& minHeight, unsigned int& maxWidth, unsigned int& maxHeight)
+    {
+        auto config = Config::Instance();
+
+        auto minRatio = std::max(config->DrsGovernorMinRatio.value_or_default(), 1.0f);
+        auto maxRatio = std::max(config->DrsGovernorMaxRatio.value_or_default(), minRatio);
+
+        minWidth = std::max(1u, (unsigned int) ((float) displayWidth / maxRatio));
+        minHeight = std::max(1u, (unsigned int) ((float) displayHeight / maxRatio));
+
+        auto scale = std::clamp(Scale(), 1.0f / maxRatio, 1.0f / minRatio);
+        maxWidth = std::max(minWidth, (unsigned int) ((float) displayWidth * scale));
+        maxHeight = std::max(minHeight, (unsigned int) ((float) displayHeight * scale));
+    }
+};
@@ -0,0 +1,223 @@
+#include <pch.h>
+#include "UpscaleFrameInputs.h"
+
+#include <nvsdk_ngx.h>
+#include <nvsdk_ngx_defs.h>
+
+static ID3D12Resource* GetResource(const NVSDK_NGX_Parameter* InParameters, const char* key)
+{
+    ID3D12Resource* resource = nullptr;
+
+    if (InParameters->Get(key, &resource) != NVSDK_NGX_Result_Success)
+        InParameters->Get(key, (void**) &resource);
+
+    return resource;
+}
+
+static UpscaleSubrectBase GetSubrectBase(const NVSDK_NGX_Parameter* InParameters, const char* keyX, const char* keyY)
+{
+    UpscaleSubrectBase base {};
+
+    InParameters->Get(keyX, &base.X);
+    InParameters->Get(keyY, &base.Y);
+
+    return base;
+}
+
+static void SetSubrectBase(NVSDK_NGX_Parameter* InParameters, const char* keyX, const char* keyY,
+                           const UpscaleSubrectBase& base)
+{
+    if (!base.IsSet())
+        return;
+
+    InParameters->Set(keyX, base.X);
+    InParameters->Set(keyY, base.Y);
+}
+
+static std::optional<float> GetOptional(const NVSDK_NGX_Parameter* InParameters, const char* key)
+{
+    float value = 0.0f;
+
+    if (InParameters->Get(key, &value) == NVSDK_NGX_Result_Success)
+        return value;
+
+    return std::nullopt;
+}
+
+void UpscaleFrameInputs::ReadRenderSize(const NVSDK_NGX_Parameter* InParameters, UpscaleFrameInputs& OutInputs)
+{
+    unsigned int width = 0;
+    unsigned int height = 0;
+
+    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, &width) ==
+            NVSDK_NGX_Result_Success &&
+        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, &height) ==
+            NVSDK_NGX_Result_Success)
+    {
+        OutInputs.RenderWidth = width;
+        OutInputs.RenderHeight = height;
+    }
+
+    if (InParameters->Get(NVSDK_NGX_Parameter_Width, &width) == NVSDK_NGX_Result_Success &&
+        InParameters->Get(NVSDK_NGX_Parameter_Height, &height) == NVSDK_NGX_Result_Success)
+    {
+        OutInputs.InputWidth = width;
+        OutInputs.InputHeight = height;
+    }
+
+    if (InParameters->Get(NVSDK_NGX_Parameter_OutWidth, &width) == NVSDK_NGX_Result_Success &&
+        InParameters->Get(NVSDK_NGX_Parameter_OutHeight, &height) == NVSDK_NGX_Result_Success)
+    {
+        OutInputs.OutputWidth = width;
+        OutInputs.OutputHeight = height;
+    }
+
+    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &OutInputs.JitterX);
+    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &OutInputs.JitterY);
+}
+
+UpscaleFrameInputs UpscaleFrameInputs::FromParameters(const NVSDK_NGX_Parameter* InParameters)
+{
+    UpscaleFrameInputs inputs {};
+
+    inputs.Color = GetResource(InParameters, NVSDK_NGX_Parameter_Color);
+    inputs.MotionVectors = GetResource(InParameters, NVSDK_NGX_Parameter_MotionVectors);
+    inputs.Depth = GetResource(InParameters, NVSDK_NGX_Parameter_Depth);
+    inputs.Output = GetResource(InParameters, NVSDK_NGX_Parameter_Output);
+    inputs.Exposure = GetResource(InParameters, NVSDK_NGX_Parameter_ExposureTexture);
+    inputs.BiasMask = GetResource(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask);
+    inputs.Reactive = GetResource(InParameters, OptiKeys::FSR_Reactive);
+    inputs.TransparencyAndComposition = GetResource(InParameters, OptiKeys::FSR_TransparencyAndComp);
+
+    ReadRenderSize(InParameters, inputs);
+
+    float mvScaleX = 1.0f;
+    float mvScaleY = 1.0f;
+
+    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &mvScaleX) == NVSDK_NGX_Result_Success &&
+        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &mvScaleY) == NVSDK_NGX_Result_Success)
+    {
+        inputs.SetMVScale(mvScaleX, mvScaleY);
+    }
+
+    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &inputs.PreExposure);
+    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &inputs.ExposureScale);
+    InParameters->Get(NVSDK_NGX_Parameter_Sharpness, &inputs.Sharpness);
+
+    int reset = 0;
+    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
+    inputs.Reset = reset == 1;
+
+    unsigned int upscaleWidth = 0;
+    unsigned int upscaleHeight = 0;
+    InParameters->Get(OptiKeys::FSR_UpscaleWidth, &upscaleWidth);
+    InParameters->Get(OptiKeys::FSR_UpscaleHeight, &upscaleHeight);
+    inputs.UpscaleWidth = upscaleWidth;
+    inputs.UpscaleHeight = upscaleHeight;
+
+    inputs.ColorBase = GetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X,
+                                      NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y);
+    inputs.DepthBase = GetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X,
+                                      NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_Y);
+    inputs.MVBase = GetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_X,
+                                   NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_Y);
+    inputs.OutputBase = GetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_X,
+                                       NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_Y);
+    inputs.BiasMaskBase = GetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_X,
+                                         NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_Y);
+
+    inputs.CameraNear = GetOptional(InParameters, OptiKeys::FSR_NearPlane);
+    inputs.CameraFar = GetOptional(InParameters, OptiKeys::FSR_FarPlane);
+    inputs.CameraFovVertical = GetOptional(InParameters, OptiKeys::FSR_CameraFovVertical);
+    inputs.FrameTimeDelta = GetOptional(InParameters, OptiKeys::FSR_FrameTimeDelta);
+    inputs.FrameTimeDeltaInMsec = GetOptional(InParameters, NVSDK_NGX_Parameter_FrameTimeDeltaInMsec);
+    inputs.ViewSpaceToMeters = GetOptional(InParameters, OptiKeys::FSR_ViewSpaceToMetersFactor);
+
+    return inputs;
+}
+
+void UpscaleFrameInputs::ApplyTo(NVSDK_NGX_Parameter* InParameters) const
+{
+    InParameters->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, JitterX);
+    InParameters->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, JitterY);
+
+    if (HasMVScale)
+    {
+        InParameters->Set(NVSDK_NGX_Parameter_MV_Scale_X, MVScaleX);
+        InParameters->Set(NVSDK_NGX_Parameter_MV_Scale_Y, MVScaleY);
+    }
+
+    InParameters->Set(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, ExposureScale);
+    InParameters->Set(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, PreExposure);
+    InParameters->Set(NVSDK_NGX_Parameter_Reset, Reset ? 1 : 0);
+    InParameters->Set(NVSDK_NGX_Parameter_Sharpness, Sharpness);
+
+    if (InputWidth > 0 && InputHeight > 0)
+    {
+        InParameters->Set(NVSDK_NGX_Parameter_Width, InputWidth);
+        InParameters->Set(NVSDK_NGX_Parameter_Height, InputHeight);
+    }
+
+    if (RenderWidth > 0 && RenderHeight > 0)
+    {
+        InParameters->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, RenderWidth);
+        InParameters->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, RenderHeight);
+    }
+
+    if (OutputWidth > 0 && OutputHeight > 0)
+    {
+        InParameters->Set(NVSDK_NGX_Parameter_OutWidth, OutputWidth);
+        InParameters->Set(NVSDK_NGX_Parameter_OutHeight, OutputHeight);
+    }
+
+    if (UpscaleWidth > 0 && UpscaleHeight > 0)
+    {
+        InParameters->Set(OptiKeys::FSR_UpscaleWidth, UpscaleWidth);
+        InParameters->Set(OptiKeys::FSR_UpscaleHeight, UpscaleHeight);
+    }
+
+    SetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X,
+                   NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y, ColorBase);
+    SetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X,
+                   NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_Y, DepthBase);
+    SetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_X,
+                   NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_Y, MVBase);
+    SetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_X,
+                   NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_Y, OutputBase);
+    SetSubrectBase(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_X,
+                   NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_Y, BiasMaskBase);
+
+    // Resources the translator didn't provide keep what the game set
+    auto setResource = [InParameters](const char* key, ID3D12Resource* resource)
+    {
+        if (resource != nullptr)
+            InParameters->Set(key, resource);
+    };
+
+    setResource(NVSDK_NGX_Parameter_Color, Color);
+    setResource(NVSDK_NGX_Parameter_MotionVectors, MotionVectors);
+    setResource(NVSDK_NGX_Parameter_Depth, Depth);
+    setResource(NVSDK_NGX_Parameter_Output, Output);
+    setResource(NVSDK_NGX_Parameter_ExposureTexture, Exposure);
+    setResource(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, BiasMask);
+    setResource(OptiKeys::FSR_Reactive, Reactive);
+    setResource(OptiKeys::FSR_TransparencyAndComp, TransparencyAndComposition);
+
+    if (CameraNear.has_value())
+        InParameters->Set(OptiKeys::FSR_NearPlane, CameraNear.value());
+
+    if (CameraFar.has_value())
+        InParameters->Set(OptiKeys::FSR_FarPlane, CameraFar.value());
+
+    if (CameraFovVertical.has_value())
+        InParameters->Set(OptiKeys::FSR_CameraFovVertical, CameraFovVertical.value());
+
+    if (FrameTimeDelta.has_value())
+        InParameters->Set(OptiKeys::FSR_FrameTimeDelta, FrameTimeDelta.value());
+
+    if (FrameTimeDeltaInMsec.has_value())
+        InParameters->Set(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, FrameTimeDeltaInMsec.value());
+
+    if (ViewSpaceToMeters.has_value())
+        InParameters->Set(OptiKeys::FSR_ViewSpaceToMetersFactor, ViewSpaceToMeters.value());
+}
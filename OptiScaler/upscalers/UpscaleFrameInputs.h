@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+struct ID3D12Resource;
+struct NVSDK_NGX_Parameter;
+
+struct UpscaleSubrectBase
+{
+    uint32_t X = 0;
+    uint32_t Y = 0;
+
+    bool IsSet() const { return X != 0 || Y != 0; }
+};
+
+// Per frame upscaler inputs in a typed form.
+// FSR, FfxApi and XeSS input translators fill this directly instead of going through a NGX parameter map,
+// DLSS callers get it built once from their parameters.
+struct UpscaleFrameInputs
+{
+    ID3D12Resource* Color = nullptr;
+    ID3D12Resource* MotionVectors = nullptr;
+    ID3D12Resource* Depth = nullptr;
+    ID3D12Resource* Output = nullptr;
+    ID3D12Resource* Exposure = nullptr;
+    ID3D12Resource* BiasMask = nullptr;
+    ID3D12Resource* Reactive = nullptr;
+    ID3D12Resource* TransparencyAndComposition = nullptr;
+
+    float JitterX = 0.0f;
+    float JitterY = 0.0f;
+    float MVScaleX = 1.0f;
+    float MVScaleY = 1.0f;
+    bool HasMVScale = false;
+    float PreExposure = 1.0f;
+    float ExposureScale = 1.0f;
+    float Sharpness = 0.0f;
+    bool Reset = false;
+
+    // Render subrect, 0 when not provided
+    uint32_t RenderWidth = 0;
+    uint32_t RenderHeight = 0;
+
+    // NGX Width/Height and OutWidth/OutHeight, used when there is no subrect
+    uint32_t InputWidth = 0;
+    uint32_t InputHeight = 0;
+    uint32_t OutputWidth = 0;
+    uint32_t OutputHeight = 0;
+
+    // FSR 3.1 upscaleSize, 0 when not provided
+    uint32_t UpscaleWidth = 0;
+    uint32_t UpscaleHeight = 0;
+
+    // NGX subrect offsets, only DLSS callers provide them
+    UpscaleSubrectBase ColorBase;
+    UpscaleSubrectBase DepthBase;
+    UpscaleSubrectBase MVBase;
+    UpscaleSubrectBase OutputBase;
+    UpscaleSubrectBase BiasMaskBase;
+
+    std::optional<float> CameraNear;
+    std::optional<float> CameraFar;
+    std::optional<float> CameraFovVertical;
+    std::optional<float> FrameTimeDelta;
+    std::optional<float> FrameTimeDeltaInMsec;
+    std::optional<float> ViewSpaceToMeters;
+
+    void SetRenderSize(uint32_t width, uint32_t height)
+    {
+        RenderWidth = width;
+        RenderHeight = height;
+        InputWidth = width;
+        InputHeight = height;
+    }
+
+    void SetMVScale(float x, float y)
+    {
+        MVScaleX = x;
+        MVScaleY = y;
+        HasMVScale = true;
+    }
+
+    static UpscaleFrameInputs FromParameters(const NVSDK_NGX_Parameter* InParameters);
+
+    // Only reads the render size and jitter values
+    static void ReadRenderSize(const NVSDK_NGX_Parameter* InParameters, UpscaleFrameInputs& OutInputs);
+
+    // Writes the inputs with the same keys the translators used to set
+    void ApplyTo(NVSDK_NGX_Parameter* InParameters) const;
+};
+
+// Makes the typed inputs of the running evaluation available to the upscaler pipeline of this thread.
+// Consumers which only know the parameter map call SyncParameters before reading it.
+class FrameInputsScope
+{
+    inline static thread_local const UpscaleFrameInputs* _current = nullptr;
+    inline static thread_local NVSDK_NGX_Parameter* _parameters = nullptr;
+    inline static thread_local bool _synced = false;
+
+    const UpscaleFrameInputs* _prevInputs;
+    NVSDK_NGX_Parameter* _prevParameters;
+    bool _prevSynced;
+
+  public:
+    // synced is true when parameters already hold the same values
+    FrameInputsScope(const UpscaleFrameInputs& inputs, NVSDK_NGX_Parameter* parameters, bool synced = false)
+        : _prevInputs(_current), _prevParameters(_parameters), _prevSynced(_synced)
+    {
+        _current = &inputs;
+        _parameters = parameters;
+        _synced = synced;
+    }
+
+    ~FrameInputsScope()
+    {
+        _current = _prevInputs;
+        _parameters = _prevParameters;
+        _synced = _prevSynced;
+    }
+
+    FrameInputsScope(const FrameInputsScope&) = delete;
+    FrameInputsScope& operator=(const FrameInputsScope&) = delete;
+
+    static const UpscaleFrameInputs* Current() { return _current; }
+
+    // Inputs of the running evaluation if they belong to these parameters
+    static const UpscaleFrameInputs* Current(const NVSDK_NGX_Parameter* parameters)
+    {
+        return _parameters == parameters ? _current : nullptr;
+    }
+
+    // Writes the typed inputs to the parameter map, only once per evaluation
+    static void SyncParameters()
+    {
+        if (_synced || _current == nullptr || _parameters == nullptr)
+            return;
+
+        _current->ApplyTo(_parameters);
+        _synced = true;
+    }
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <vulkan/vulkan.h>
+
+// Decides if a Vulkan image can be used by the D3D12 side directly (aliased through external memory)
+// or needs to be copied into one of our shared textures. Kept free of any device calls.
+namespace VkInterop
+{
+enum class ImportMode : uint8_t
+{
+    Alias,      // Image memory is exported as a D3D12 resource, open it and skip the copy
+    Copy,       // Copy into our own shared texture
+    Unsupported // No DXGI equivalent, interop is not possible
+};
+
+struct ImageInfo
+{
+    VkFormat Format = VK_FORMAT_UNDEFINED;
+    bool HasDxgiFormat = false;
+    VkImageUsageFlags Usage = 0;
+    VkImageTiling Tiling = VK_IMAGE_TILING_OPTIMAL;
+    VkSampleCountFlagBits Samples = VK_SAMPLE_COUNT_1_BIT;
+    uint32_t MipLevels = 1;
+    uint32_t ArrayLayers = 1;
+
+    // Handle types from VkExternalMemoryImageCreateInfo
+    VkExternalMemoryHandleTypeFlags ImageHandleTypes = 0;
+
+    // Handle types from VkExportMemoryAllocateInfo of the bound memory
+    VkExternalMemoryHandleTypeFlags MemoryHandleTypes = 0;
+
+    // Memory was allocated with VkMemoryDedicatedAllocateInfo for this image
+    bool DedicatedMemory = false;
+};
+
+[[nodiscard]] inline ImportMode GetImportMode(const ImageInfo& info, bool isOutput, bool isDepth)
+{
+    if (!info.HasDxgiFormat)
+        return ImportMode::Unsupported;
+
+    // Depth needs to be converted to R32 by DepthTransfer
+    if (isDepth)
+        return ImportMode::Copy;
+
+    // Only dedicated D3D12 resource handles can be opened as ID3D12Resource
+    constexpr VkExternalMemoryHandleTypeFlags d3d12Resource = VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D12_RESOURCE_BIT;
+
+    if ((info.ImageHandleTypes & d3d12Resource) == 0 || (info.MemoryHandleTypes & d3d12Resource) == 0 ||
+        !info.DedicatedMemory)
+    {
+        return ImportMode::Copy;
+    }
+
+    // D3D12 side is always created with unknown (optimal) layout and single sample
+    if (info.Tiling != VK_IMAGE_TILING_OPTIMAL || info.Samples != VK_SAMPLE_COUNT_1_BIT)
+        return ImportMode::Copy;
+
+    if (info.MipLevels != 1 || info.ArrayLayers != 1)
+        return ImportMode::Copy;
+
+    if (isOutput)
+    {
+        if ((info.Usage & VK_IMAGE_USAGE_STORAGE_BIT) == 0)
+            return ImportMode::Copy;
+    }
+    else if ((info.Usage & VK_IMAGE_USAGE_SAMPLED_BIT) == 0)
+    {
+        return ImportMode::Copy;
+    }
+
+    return ImportMode::Alias;
+}
+} // namespace VkInterop
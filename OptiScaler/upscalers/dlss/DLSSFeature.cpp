@@ -70,12 +70,12 @@ void DLSSFeature::ProcessInitParams(NVSDK_NGX_Parameter* InParameters)
         if (ssMulti < 0.5f)
         {
             ssMulti = 0.5f;
-            Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti);
+            UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti); });
         }
         else if (ssMulti > 3.0f)
         {
             ssMulti = 3.0f;
-            Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti);
+            UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti); });
         }
 
         _targetWidth = static_cast<unsigned int>(DisplayWidth() * ssMulti);
@@ -97,8 +97,8 @@ void DLSSFeature::ProcessInitParams(NVSDK_NGX_Parameter* InParameters)
         // enable output scaling to restore image
         if (LowResMV())
         {
-            Config::Instance()->OutputScalingMultiplier.set_volatile_value(1.0f);
-            Config::Instance()->OutputScalingEnabled.set_volatile_value(true);
+            UpdateConfig([] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(1.0f); });
+            UpdateConfig([] { Config::Instance()->OutputScalingEnabled.set_volatile_value(true); });
         }
     }
 
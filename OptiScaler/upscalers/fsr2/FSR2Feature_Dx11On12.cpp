@@ -167,7 +167,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.renderSize.width, params.renderSize.height);
 
-    auto frame = _frameCount % 2;
+    auto frame = InteropFrameIndex();
     auto cmdList = Dx12CommandList[frame];
 
     params.commandList = ffxGetCommandListDX12(cmdList);
@@ -31,15 +31,25 @@ bool FSR2FeatureDx12::Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* In
 }
 
 bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_NGX_Parameter* InParameters)
+{
+    // Translators and the DLSS input path already provide typed inputs
+    if (auto inputs = FrameInputsScope::Current(InParameters); inputs != nullptr)
+        return EvaluateInputs(InCommandList, *inputs);
+
+    return EvaluateInputs(InCommandList, UpscaleFrameInputs::FromParameters(InParameters));
+}
+
+bool FSR2FeatureDx12::EvaluateInputs(ID3D12GraphicsCommandList* InCommandList, const UpscaleFrameInputs& InInputs)
 {
     LOG_FUNC();
 
     if (!IsInited())
         return false;
 
-    auto& state = State::Instance();
+    // Barriers of this evaluation are issued together before each pass
+    BarrierBatch_Dx12 barriers(InCommandList);
+
     auto& cfg = *Config::Instance();
-    const auto& ngxParams = *InParameters;
 
     if (!RCAS->IsInit())
         Config::Instance()->RcasEnabled.set_volatile_value(false);
@@ -49,13 +59,10 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     FfxFsr2DispatchDescription params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffset.x);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffset.y);
+    params.jitterOffset.x = InInputs.JitterX;
+    params.jitterOffset.y = InInputs.JitterY;
 
-    if (Config::Instance()->OverrideSharpness.value_or_default())
-        _sharpness = Config::Instance()->Sharpness.value_or_default();
-    else
-        _sharpness = GetSharpness(InParameters);
+    _sharpness = GetSharpness(InInputs);
 
     if (Config::Instance()->RcasEnabled.value_or_default())
     {
@@ -71,20 +78,16 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         params.sharpness = _sharpness;
     }
 
-    unsigned int reset;
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
-    params.reset = (reset == 1);
+    params.reset = InInputs.Reset;
 
-    GetRenderResolution(InParameters, &params.renderSize.width, &params.renderSize.height);
+    GetRenderResolution(InInputs, &params.renderSize.width, &params.renderSize.height);
     LOG_DEBUG("Input Resolution: {0}x{1}", params.renderSize.width, params.renderSize.height);
 
     bool useSS = Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV();
 
     params.commandList = ffxGetCommandListDX12(InCommandList);
 
-    ID3D12Resource* paramColor;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor);
+    ID3D12Resource* paramColor = InInputs.Color;
 
     if (paramColor)
     {
@@ -113,9 +116,7 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramVelocity;
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+    ID3D12Resource* paramVelocity = InInputs.MotionVectors;
 
     if (paramVelocity)
     {
@@ -144,9 +145,7 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramOutput;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput);
+    ID3D12Resource* paramOutput = InInputs.Output;
 
     if (paramOutput)
     {
@@ -192,9 +191,7 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramDepth;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth);
+    ID3D12Resource* paramDepth = InInputs.Depth;
 
     if (paramDepth)
     {
@@ -221,8 +218,7 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     }
     else
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExp) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExp);
+        paramExp = InInputs.Exposure;
 
         if (paramExp)
         {
@@ -245,14 +241,9 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         }
     }
 
-    ID3D12Resource* paramTransparency = nullptr;
-    InParameters->Get("FSR.transparencyAndComposition", (void**) &paramTransparency);
-
-    ID3D12Resource* paramReactiveMask = nullptr;
-    InParameters->Get("FSR.reactive", (void**) &paramReactiveMask);
-
-    ID3D12Resource* paramReactiveMask2 = nullptr;
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask2);
+    ID3D12Resource* paramTransparency = InInputs.TransparencyAndComposition;
+    ID3D12Resource* paramReactiveMask = InInputs.Reactive;
+    ID3D12Resource* paramReactiveMask2 = InInputs.BiasMask;
 
     if (!Config::Instance()->DisableReactiveMask.value_or(paramReactiveMask == nullptr &&
                                                           paramReactiveMask2 == nullptr))
@@ -319,34 +310,31 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     _accessToReactiveMask = paramReactiveMask != nullptr;
     _hasOutput = params.output.resource != nullptr;
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
+    if (!InInputs.HasMVScale)
+        LOG_WARN("Can't get motion vector scales!");
+
+    params.motionVectorScale.x = InInputs.MVScaleX;
+    params.motionVectorScale.y = InInputs.MVScaleY;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+    const bool useFsrInputs = cfg.FsrUseFsrInputValues.value_or_default();
+
+    if (useFsrInputs && InInputs.CameraNear.has_value())
     {
-        params.motionVectorScale.x = MVScaleX;
-        params.motionVectorScale.y = MVScaleY;
+        params.cameraNear = InInputs.CameraNear.value();
     }
     else
-    {
-        LOG_WARN("Can't get motion vector scales!");
-
-        params.motionVectorScale.x = MVScaleX;
-        params.motionVectorScale.y = MVScaleY;
-    }
-
-    if (!Config::Instance()->FsrUseFsrInputValues.value_or_default() ||
-        InParameters->Get("FSR.cameraNear", &params.cameraNear) != NVSDK_NGX_Result_Success)
     {
         if (DepthInverted())
-            params.cameraFar = Config::Instance()->FsrCameraNear.value_or_default();
+            params.cameraFar = cfg.FsrCameraNear.value_or_default();
         else
-            params.cameraNear = Config::Instance()->FsrCameraNear.value_or_default();
+            params.cameraNear = cfg.FsrCameraNear.value_or_default();
     }
 
-    if (!cfg.FsrUseFsrInputValues.value_or_default() ||
-        ngxParams.Get(OptiKeys::FSR_FarPlane, &params.cameraFar) != NVSDK_NGX_Result_Success)
+    if (useFsrInputs && InInputs.CameraFar.has_value())
+    {
+        params.cameraFar = InInputs.CameraFar.value();
+    }
+    else
     {
         if (DepthInverted())
             params.cameraNear = cfg.FsrCameraFar.value_or_default();
@@ -354,8 +342,11 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
             params.cameraFar = cfg.FsrCameraFar.value_or_default();
     }
 
-    if (!cfg.FsrUseFsrInputValues.value_or_default() ||
-        ngxParams.Get(OptiKeys::FSR_CameraFovVertical, &params.cameraFovAngleVertical) != NVSDK_NGX_Result_Success)
+    if (useFsrInputs && InInputs.CameraFovVertical.has_value())
+    {
+        params.cameraFovAngleVertical = InInputs.CameraFovVertical.value();
+    }
+    else
     {
         if (cfg.FsrVerticalFov.has_value())
             params.cameraFovAngleVertical = GetRadiansFromDeg(cfg.FsrVerticalFov.value());
@@ -369,19 +360,17 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
             params.cameraFovAngleVertical = GetRadiansFromDeg(60);
     }
 
-    if (!Config::Instance()->FsrUseFsrInputValues.value_or_default() ||
-        InParameters->Get("FSR.frameTimeDelta", &params.frameTimeDelta) != NVSDK_NGX_Result_Success)
-    {
-        if (InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, &params.frameTimeDelta) !=
-                NVSDK_NGX_Result_Success ||
-            params.frameTimeDelta < 1.0f)
-            params.frameTimeDelta = (float) GetDeltaTime();
-    }
+    if (useFsrInputs && InInputs.FrameTimeDelta.has_value())
+        params.frameTimeDelta = InInputs.FrameTimeDelta.value();
+    else if (InInputs.FrameTimeDeltaInMsec.value_or(0.0f) >= 1.0f)
+        params.frameTimeDelta = InInputs.FrameTimeDeltaInMsec.value();
+    else
+        params.frameTimeDelta = (float) GetDeltaTime();
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &params.preExposure) != NVSDK_NGX_Result_Success)
-        params.preExposure = 1.0f;
+    params.preExposure = InInputs.PreExposure;
 
     LOG_DEBUG("Dispatch!!");
+    barriers.Flush();
     auto result = ffxFsr2ContextDispatch(&_context, &params);
 
     if (result != FFX_OK)
@@ -407,8 +396,8 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         rcasConstants.Sharpness = _sharpness;
         rcasConstants.DisplayWidth = TargetWidth();
         rcasConstants.DisplayHeight = TargetHeight();
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+        rcasConstants.MvScaleX = InInputs.MVScaleX;
+        rcasConstants.MvScaleY = InInputs.MVScaleY;
         rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
         rcasConstants.RenderHeight = RenderHeight();
         rcasConstants.RenderWidth = RenderWidth();
@@ -446,6 +435,8 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         }
     }
 
+    barriers.Flush();
+
     // imgui
     if (!Config::Instance()->OverlayMenu.value_or_default() && _frameCount > 30)
     {
@@ -550,12 +541,12 @@ bool FSR2FeatureDx12::InitFSR2(const NVSDK_NGX_Parameter* InParameters)
             if (ssMulti < 0.5f)
             {
                 ssMulti = 0.5f;
-                Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti);
+                UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti); });
             }
             else if (ssMulti > 3.0f)
             {
                 ssMulti = 3.0f;
-                Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti);
+                UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti); });
             }
 
             _targetWidth = static_cast<unsigned int>(DisplayWidth() * ssMulti);
@@ -573,7 +564,7 @@ bool FSR2FeatureDx12::InitFSR2(const NVSDK_NGX_Parameter* InParameters)
             _contextDesc.maxRenderSize.width = RenderWidth();
             _contextDesc.maxRenderSize.height = RenderHeight();
 
-            Config::Instance()->OutputScalingMultiplier.set_volatile_value(1.0f);
+            UpdateConfig([] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(1.0f); });
 
             // if output scaling active let it to handle downsampling
             if (Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV())
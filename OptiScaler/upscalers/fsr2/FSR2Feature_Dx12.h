@@ -10,6 +10,7 @@ class FSR2FeatureDx12 : public FSR2Feature, public IFeature_Dx12
   private:
   protected:
     bool InitFSR2(const NVSDK_NGX_Parameter* InParameters);
+    bool EvaluateInputs(ID3D12GraphicsCommandList* InCommandList, const UpscaleFrameInputs& InInputs);
 
   public:
     FSR2FeatureDx12(unsigned int InHandleId, NVSDK_NGX_Parameter* InParameters)
@@ -21,6 +22,7 @@ class FSR2FeatureDx12 : public FSR2Feature, public IFeature_Dx12
     bool Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCommandList,
               NVSDK_NGX_Parameter* InParameters) override;
     bool Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_NGX_Parameter* InParameters) override;
+    bool UsesFrameInputs() const override { return true; }
 
     feature_version Version() override { return FSR2Feature::Version(); }
     std::string Name() const override { return FSR2Feature::Name(); }
@@ -37,6 +37,9 @@ bool FSR2FeatureDx12_212::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVS
     if (!IsInited())
         return false;
 
+    // Barriers of this evaluation are issued together before each pass
+    BarrierBatch_Dx12 barriers(InCommandList);
+
     auto& state = State::Instance();
     auto& cfg = *Config::Instance();
     const auto& ngxParams = *InParameters;
@@ -392,6 +395,7 @@ bool FSR2FeatureDx12_212::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVS
         params.preExposure = 1.0f;
 
     LOG_DEBUG("Dispatch!!");
+    barriers.Flush();
     auto result = Fsr212::ffxFsr2ContextDispatch212(&_context, &params);
 
     if (result != Fsr212::FFX_OK)
@@ -456,6 +460,8 @@ bool FSR2FeatureDx12_212::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVS
         }
     }
 
+    barriers.Flush();
+
     // imgui
     if (!Config::Instance()->OverlayMenu.value_or_default() && _frameCount > 30)
     {
@@ -561,12 +567,12 @@ bool FSR2FeatureDx12_212::InitFSR2(const NVSDK_NGX_Parameter* InParameters)
             if (ssMulti < 0.5f)
             {
                 ssMulti = 0.5f;
-                Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti);
+                UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti); });
             }
             else if (ssMulti > 3.0f)
             {
                 ssMulti = 3.0f;
-                Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti);
+                UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti); });
             }
 
             _targetWidth = static_cast<unsigned int>(DisplayWidth() * ssMulti);
@@ -584,7 +590,7 @@ bool FSR2FeatureDx12_212::InitFSR2(const NVSDK_NGX_Parameter* InParameters)
             _contextDesc.maxRenderSize.width = RenderWidth();
             _contextDesc.maxRenderSize.height = RenderHeight();
 
-            Config::Instance()->OutputScalingMultiplier.set_volatile_value(1.0f);
+            UpdateConfig([] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(1.0f); });
 
             // if output scaling active let it to handle downsampling
             if (Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV())
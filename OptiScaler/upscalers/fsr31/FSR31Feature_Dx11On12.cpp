@@ -210,7 +210,7 @@ bool FSR31FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.renderSize.width, params.renderSize.height);
 
-    auto frame = _frameCount % 2;
+    auto frame = InteropFrameIndex();
     auto cmdList = Dx12CommandList[frame];
 
     params.commandList = cmdList;
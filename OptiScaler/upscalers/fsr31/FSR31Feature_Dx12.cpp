@@ -53,14 +53,25 @@ bool FSR31FeatureDx12::Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* I
 }
 
 bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_NGX_Parameter* InParameters)
+{
+    // Translators and the DLSS input path already provide typed inputs
+    if (auto inputs = FrameInputsScope::Current(InParameters); inputs != nullptr)
+        return EvaluateInputs(InCommandList, *inputs);
+
+    return EvaluateInputs(InCommandList, UpscaleFrameInputs::FromParameters(InParameters));
+}
+
+bool FSR31FeatureDx12::EvaluateInputs(ID3D12GraphicsCommandList* InCommandList, const UpscaleFrameInputs& InInputs)
 {
     LOG_FUNC();
 
     if (!IsInited())
         return false;
 
+    // Barriers of this evaluation are issued together before each pass
+    BarrierBatch_Dx12 barriers(InCommandList);
+
     auto& cfg = *Config::Instance();
-    const auto& ngxParams = *InParameters;
 
     if (!RCAS->IsInit())
         Config::Instance()->RcasEnabled.set_volatile_value(false);
@@ -84,13 +95,10 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
     else if (Config::Instance()->FsrNonLinearSRGB.value_or_default())
         params.flags |= FFX_UPSCALE_FLAG_NON_LINEAR_COLOR_SRGB;
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffset.x);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffset.y);
+    params.jitterOffset.x = InInputs.JitterX;
+    params.jitterOffset.y = InInputs.JitterY;
 
-    if (Config::Instance()->OverrideSharpness.value_or_default())
-        _sharpness = Config::Instance()->Sharpness.value_or_default();
-    else
-        _sharpness = GetSharpness(InParameters);
+    _sharpness = GetSharpness(InInputs);
 
     if (Config::Instance()->RcasEnabled.value_or_default())
     {
@@ -118,11 +126,9 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
 
     LOG_DEBUG("Jitter Offset: {0}x{1}", params.jitterOffset.x, params.jitterOffset.y);
 
-    unsigned int reset;
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
-    params.reset = (reset == 1);
+    params.reset = InInputs.Reset;
 
-    GetRenderResolution(InParameters, &params.renderSize.width, &params.renderSize.height);
+    GetRenderResolution(InInputs, &params.renderSize.width, &params.renderSize.height);
 
     bool useSS = Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV();
 
@@ -130,9 +136,7 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
 
     params.commandList = InCommandList;
 
-    ID3D12Resource* paramColor;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor);
+    ID3D12Resource* paramColor = InInputs.Color;
 
     if (paramColor)
     {
@@ -160,9 +164,7 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         return false;
     }
 
-    ID3D12Resource* paramVelocity;
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+    ID3D12Resource* paramVelocity = InInputs.MotionVectors;
 
     if (paramVelocity)
     {
@@ -188,9 +190,7 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         return false;
     }
 
-    ID3D12Resource* paramOutput;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput);
+    ID3D12Resource* paramOutput = InInputs.Output;
 
     if (paramOutput)
     {
@@ -232,9 +232,7 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         return false;
     }
 
-    ID3D12Resource* paramDepth;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth);
+    ID3D12Resource* paramDepth = InInputs.Depth;
 
     if (paramDepth)
     {
@@ -262,8 +260,7 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
     }
     else
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExp) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExp);
+        paramExp = InInputs.Exposure;
 
         if (paramExp)
         {
@@ -285,18 +282,9 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         }
     }
 
-    ID3D12Resource* paramTransparency = nullptr;
-    if (InParameters->Get("FSR.transparencyAndComposition", &paramTransparency) == NVSDK_NGX_Result_Success)
-        InParameters->Get("FSR.transparencyAndComposition", (void**) &paramTransparency);
-
-    ID3D12Resource* paramReactiveMask = nullptr;
-    if (InParameters->Get("FSR.reactive", &paramReactiveMask) == NVSDK_NGX_Result_Success)
-        InParameters->Get("FSR.reactive", (void**) &paramReactiveMask);
-
-    ID3D12Resource* paramReactiveMask2 = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask2) !=
-        NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask2);
+    ID3D12Resource* paramTransparency = InInputs.TransparencyAndComposition;
+    ID3D12Resource* paramReactiveMask = InInputs.Reactive;
+    ID3D12Resource* paramReactiveMask2 = InInputs.BiasMask;
 
     if (!Config::Instance()->DisableReactiveMask.value_or(paramReactiveMask == nullptr &&
                                                           paramReactiveMask2 == nullptr))
@@ -372,36 +360,33 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         ffxResolveTypelessFormat(params.output.description.format);
     }
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
-
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
-    {
-        params.motionVectorScale.x = MVScaleX;
-        params.motionVectorScale.y = MVScaleY;
-    }
-    else
-    {
+    if (!InInputs.HasMVScale)
         LOG_WARN("Can't get motion vector scales!");
 
-        params.motionVectorScale.x = MVScaleX;
-        params.motionVectorScale.y = MVScaleY;
-    }
+    params.motionVectorScale.x = InInputs.MVScaleX;
+    params.motionVectorScale.y = InInputs.MVScaleY;
 
     LOG_DEBUG("Sharpness: {0}", params.sharpness);
 
-    if (!Config::Instance()->FsrUseFsrInputValues.value_or_default() ||
-        InParameters->Get("FSR.cameraNear", &params.cameraNear) != NVSDK_NGX_Result_Success)
+    const bool useFsrInputs = cfg.FsrUseFsrInputValues.value_or_default();
+
+    if (useFsrInputs && InInputs.CameraNear.has_value())
+    {
+        params.cameraNear = InInputs.CameraNear.value();
+    }
+    else
     {
         if (DepthInverted())
-            params.cameraFar = Config::Instance()->FsrCameraNear.value_or_default();
+            params.cameraFar = cfg.FsrCameraNear.value_or_default();
         else
-            params.cameraNear = Config::Instance()->FsrCameraNear.value_or_default();
+            params.cameraNear = cfg.FsrCameraNear.value_or_default();
     }
 
-    if (!Config::Instance()->FsrUseFsrInputValues.value_or_default() ||
-        InParameters->Get("FSR.cameraFar", &params.cameraFar) != NVSDK_NGX_Result_Success)
+    if (useFsrInputs && InInputs.CameraFar.has_value())
+    {
+        params.cameraFar = InInputs.CameraFar.value();
+    }
+    else
     {
         if (DepthInverted())
             params.cameraNear = cfg.FsrCameraFar.value_or_default();
@@ -409,8 +394,11 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
             params.cameraFar = cfg.FsrCameraFar.value_or_default();
     }
 
-    if (!cfg.FsrUseFsrInputValues.value_or_default() ||
-        ngxParams.Get(OptiKeys::FSR_CameraFovVertical, &params.cameraFovAngleVertical) != NVSDK_NGX_Result_Success)
+    if (useFsrInputs && InInputs.CameraFovVertical.has_value())
+    {
+        params.cameraFovAngleVertical = InInputs.CameraFovVertical.value();
+    }
+    else
     {
         if (cfg.FsrVerticalFov.has_value())
             params.cameraFovAngleVertical = GetRadiansFromDeg(cfg.FsrVerticalFov.value());
@@ -424,23 +412,21 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
             params.cameraFovAngleVertical = GetRadiansFromDeg(60);
     }
 
-    if (!Config::Instance()->FsrUseFsrInputValues.value_or_default() ||
-        InParameters->Get("FSR.frameTimeDelta", &params.frameTimeDelta) != NVSDK_NGX_Result_Success)
-    {
-        if (InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, &params.frameTimeDelta) !=
-                NVSDK_NGX_Result_Success ||
-            params.frameTimeDelta < 1.0f)
-            params.frameTimeDelta = (float) GetDeltaTime();
-    }
+    if (useFsrInputs && InInputs.FrameTimeDelta.has_value())
+        params.frameTimeDelta = InInputs.FrameTimeDelta.value();
+    else if (InInputs.FrameTimeDeltaInMsec.value_or(0.0f) >= 1.0f)
+        params.frameTimeDelta = InInputs.FrameTimeDeltaInMsec.value();
+    else
+        params.frameTimeDelta = (float) GetDeltaTime();
 
     LOG_DEBUG("FrameTimeDeltaInMsec: {0}", params.frameTimeDelta);
 
-    if (!Config::Instance()->FsrUseFsrInputValues.value_or_default() ||
-        InParameters->Get("FSR.viewSpaceToMetersFactor", &params.viewSpaceToMetersFactor) != NVSDK_NGX_Result_Success)
+    if (useFsrInputs && InInputs.ViewSpaceToMeters.has_value())
+        params.viewSpaceToMetersFactor = InInputs.ViewSpaceToMeters.value();
+    else
         params.viewSpaceToMetersFactor = 0.0f;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &params.preExposure) != NVSDK_NGX_Result_Success)
-        params.preExposure = 1.0f;
+    params.preExposure = InInputs.PreExposure;
 
     if (Version() >= feature_version { 3, 1, 1 } && _velocity != Config::Instance()->FsrVelocity.value_or_default())
     {
@@ -510,8 +496,10 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         }
     }
 
-    if (InParameters->Get("FSR.upscaleSize.width", &params.upscaleSize.width) == NVSDK_NGX_Result_Success &&
-        Config::Instance()->OutputScalingEnabled.value_or_default())
+    params.upscaleSize.width = InInputs.UpscaleWidth;
+    params.upscaleSize.height = InInputs.UpscaleHeight;
+
+    if (params.upscaleSize.width != 0 && Config::Instance()->OutputScalingEnabled.value_or_default())
     {
         auto originalWidth = static_cast<float>(params.upscaleSize.width);
         params.upscaleSize.width =
@@ -522,8 +510,7 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         params.upscaleSize.width = TargetWidth();
     }
 
-    if (InParameters->Get("FSR.upscaleSize.height", &params.upscaleSize.height) == NVSDK_NGX_Result_Success &&
-        Config::Instance()->OutputScalingEnabled.value_or_default())
+    if (params.upscaleSize.height != 0 && Config::Instance()->OutputScalingEnabled.value_or_default())
     {
         auto originalHeight = static_cast<float>(params.upscaleSize.height);
         params.upscaleSize.height =
@@ -535,6 +522,7 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
     }
 
     LOG_DEBUG("Dispatch!!");
+    barriers.Flush();
     auto result = FfxApiProxy::D3D12_Dispatch(&_context, &params.header);
 
     if (result != FFX_API_RETURN_OK)
@@ -567,8 +555,8 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         rcasConstants.Sharpness = _sharpness;
         rcasConstants.DisplayWidth = TargetWidth();
         rcasConstants.DisplayHeight = TargetHeight();
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+        rcasConstants.MvScaleX = InInputs.MVScaleX;
+        rcasConstants.MvScaleY = InInputs.MVScaleY;
         rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
         rcasConstants.RenderHeight = RenderHeight();
         rcasConstants.RenderWidth = RenderWidth();
@@ -606,6 +594,8 @@ bool FSR31FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
         }
     }
 
+    barriers.Flush();
+
     // imgui
     if (!Config::Instance()->OverlayMenu.value_or_default() && _frameCount > 30)
     {
@@ -734,12 +724,12 @@ bool FSR31FeatureDx12::InitFSR3(const NVSDK_NGX_Parameter* InParameters)
             if (ssMulti < 0.5f)
             {
                 ssMulti = 0.5f;
-                Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti);
+                UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti); });
             }
             else if (ssMulti > 3.0f)
             {
                 ssMulti = 3.0f;
-                Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti);
+                UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(ssMulti); });
             }
 
             _targetWidth = static_cast<unsigned int>(DisplayWidth() * ssMulti);
@@ -757,7 +747,7 @@ bool FSR31FeatureDx12::InitFSR3(const NVSDK_NGX_Parameter* InParameters)
             _contextDesc.maxRenderSize.width = RenderWidth();
             _contextDesc.maxRenderSize.height = RenderHeight();
 
-            Config::Instance()->OutputScalingMultiplier.set_volatile_value(1.0f);
+            UpdateConfig([] { Config::Instance()->OutputScalingMultiplier.set_volatile_value(1.0f); });
 
             // if output scaling active let it to handle downsampling
             if (Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV())
@@ -789,14 +779,17 @@ bool FSR31FeatureDx12::InitFSR3(const NVSDK_NGX_Parameter* InParameters)
 
         _contextDesc.header.pNext = &backendDesc.header;
 
-        if (Config::Instance()->FfxUpscalerIndex.value_or_default() < 0 ||
-            Config::Instance()->FfxUpscalerIndex.value_or_default() >= State::Instance().ffxUpscalerVersionIds.size())
-            Config::Instance()->FfxUpscalerIndex.set_volatile_value(0);
+        auto upscalerIndex = Config::Instance()->FfxUpscalerIndex.value_or_default();
+
+        if (upscalerIndex < 0 || upscalerIndex >= State::Instance().ffxUpscalerVersionIds.size())
+        {
+            upscalerIndex = 0;
+            UpdateConfig([] { Config::Instance()->FfxUpscalerIndex.set_volatile_value(0); });
+        }
 
         ffxOverrideVersion override = { 0 };
         override.header.type = FFX_API_DESC_TYPE_OVERRIDE_VERSION;
-        override.versionId =
-            State::Instance().ffxUpscalerVersionIds[Config::Instance()->FfxUpscalerIndex.value_or_default()];
+        override.versionId = State::Instance().ffxUpscalerVersionIds[upscalerIndex];
         backendDesc.header.pNext = &override.header;
 
         LOG_DEBUG("_createContext!");
@@ -813,8 +806,7 @@ bool FSR31FeatureDx12::InitFSR3(const NVSDK_NGX_Parameter* InParameters)
             }
         }
 
-        auto version =
-            State::Instance().ffxUpscalerVersionNames[Config::Instance()->FfxUpscalerIndex.value_or_default()];
+        auto version = State::Instance().ffxUpscalerVersionNames[upscalerIndex];
         _name = "FSR";
         parse_version(version);
     }
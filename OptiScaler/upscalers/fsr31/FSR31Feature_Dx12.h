@@ -12,6 +12,7 @@ class FSR31FeatureDx12 : public FSR31Feature, public IFeature_Dx12
 
   protected:
     bool InitFSR3(const NVSDK_NGX_Parameter* InParameters);
+    bool EvaluateInputs(ID3D12GraphicsCommandList* InCommandList, const UpscaleFrameInputs& InInputs);
 
   public:
     FSR31FeatureDx12(unsigned int InHandleId, NVSDK_NGX_Parameter* InParameters);
@@ -19,6 +20,7 @@ class FSR31FeatureDx12 : public FSR31Feature, public IFeature_Dx12
     bool Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCommandList,
               NVSDK_NGX_Parameter* InParameters) override;
     bool Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_NGX_Parameter* InParameters) override;
+    bool UsesFrameInputs() const override { return true; }
 
     feature_version Version() override { return FSR31Feature::Version(); }
     std::string Name() const override { return FSR31Feature::Name(); }
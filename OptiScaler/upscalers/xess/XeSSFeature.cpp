@@ -20,8 +20,7 @@ bool XeSSFeature::InitXeSS(ID3D12Device* device, const NVSDK_NGX_Parameter* InPa
 
     if (!_moduleLoaded)
     {
-        ImGui::InsertNotification(
-            { ImGuiToastType::Warning, 10000, "Couldn't load libxess.dll\nCheck if the dll is present" });
+        Notify(ImGuiToastType::Warning, "Couldn't load libxess.dll\nCheck if the dll is present");
         LOG_ERROR("libxess.dll not loaded!");
         return false;
     }
@@ -43,8 +42,7 @@ bool XeSSFeature::InitXeSS(ID3D12Device* device, const NVSDK_NGX_Parameter* InPa
         if (ret != XESS_RESULT_SUCCESS)
         {
             auto str = ResultToString(ret);
-            ImGui::InsertNotification(
-                { ImGuiToastType::Error, 10000, std::format("Couldn't create XeSS context\n{}", str).c_str() });
+            Notify(ImGuiToastType::Error, std::format("Couldn't create XeSS context\n{}", str));
             LOG_ERROR("xessD3D12CreateContext error: {0}", str);
             return false;
         }
@@ -159,12 +157,12 @@ bool XeSSFeature::InitXeSS(ID3D12Device* device, const NVSDK_NGX_Parameter* InPa
             if (ssMulti < 0.5f)
             {
                 ssMulti = 0.5f;
-                Config::Instance()->OutputScalingMultiplier = ssMulti;
+                UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier = ssMulti; });
             }
             else if (ssMulti > 3.0f)
             {
                 ssMulti = 3.0f;
-                Config::Instance()->OutputScalingMultiplier = ssMulti;
+                UpdateConfig([ssMulti] { Config::Instance()->OutputScalingMultiplier = ssMulti; });
             }
 
             _targetWidth = static_cast<unsigned int>(DisplayWidth() * ssMulti);
@@ -184,8 +182,8 @@ bool XeSSFeature::InitXeSS(ID3D12Device* device, const NVSDK_NGX_Parameter* InPa
             // enable output scaling to restore image
             if (LowResMV())
             {
-                Config::Instance()->OutputScalingMultiplier = 1.0f;
-                Config::Instance()->OutputScalingEnabled = true;
+                UpdateConfig([] { Config::Instance()->OutputScalingMultiplier = 1.0f; });
+                UpdateConfig([] { Config::Instance()->OutputScalingEnabled = true; });
             }
         }
 
@@ -223,7 +221,7 @@ bool XeSSFeature::InitXeSS(ID3D12Device* device, const NVSDK_NGX_Parameter* InPa
 
                     if (SUCCEEDED(hr))
                     {
-                        Config::Instance()->CreateHeaps = true;
+                        UpdateConfig([] { Config::Instance()->CreateHeaps = true; });
 
                         LOG_DEBUG("using _localBufferHeap & _localTextureHeap!");
 
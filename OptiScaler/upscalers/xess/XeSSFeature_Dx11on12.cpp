@@ -184,7 +184,7 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.inputWidth, params.inputHeight);
 
-    auto frame = _frameCount % 2;
+    auto frame = InteropFrameIndex();
     auto cmdList = Dx12CommandList[frame];
 
     uint8_t state = 0;
@@ -30,6 +30,15 @@ bool XeSSFeatureDx12::Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* In
 }
 
 bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_NGX_Parameter* InParameters)
+{
+    // Translators and the DLSS input path already provide typed inputs
+    if (auto inputs = FrameInputsScope::Current(InParameters); inputs != nullptr)
+        return EvaluateInputs(InCommandList, *inputs);
+
+    return EvaluateInputs(InCommandList, UpscaleFrameInputs::FromParameters(InParameters));
+}
+
+bool XeSSFeatureDx12::EvaluateInputs(ID3D12GraphicsCommandList* InCommandList, const UpscaleFrameInputs& InInputs)
 {
     LOG_FUNC();
 
@@ -39,6 +48,9 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
+    // Barriers of this evaluation are issued together before each pass
+    BarrierBatch_Dx12 barriers(InCommandList);
+
     if (!RCAS->IsInit())
         Config::Instance()->RcasEnabled = false;
 
@@ -69,18 +81,16 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     xess_d3d12_execute_params_t params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffsetX);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffsetY);
+    params.jitterOffsetX = InInputs.JitterX;
+    params.jitterOffsetY = InInputs.JitterY;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &params.exposureScale) != NVSDK_NGX_Result_Success ||
-        params.exposureScale <= 0.0f)
-        params.exposureScale = 1.0f;
+    params.exposureScale = InInputs.ExposureScale > 0.0f ? InInputs.ExposureScale : 1.0f;
 
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &params.resetHistory);
+    params.resetHistory = InInputs.Reset ? 1 : 0;
 
-    GetRenderResolution(InParameters, &params.inputWidth, &params.inputHeight);
+    GetRenderResolution(InInputs, &params.inputWidth, &params.inputHeight);
 
-    _sharpness = GetSharpness(InParameters);
+    _sharpness = GetSharpness(InInputs);
 
     float ssMulti = Config::Instance()->OutputScalingMultiplier.value_or(1.5f);
 
@@ -88,9 +98,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.inputWidth, params.inputHeight);
 
-    ID3D12Resource* paramColor;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor);
+    ID3D12Resource* paramColor = InInputs.Color;
 
     if (paramColor)
     {
@@ -119,8 +127,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &params.pVelocityTexture) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &params.pVelocityTexture);
+    params.pVelocityTexture = InInputs.MotionVectors;
 
     if (params.pVelocityTexture)
     {
@@ -147,10 +154,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramOutput;
-
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput);
+    ID3D12Resource* paramOutput = InInputs.Output;
 
     if (paramOutput)
     {
@@ -196,8 +200,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     if (LowResMV())
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &params.pDepthTexture) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &params.pDepthTexture);
+        params.pDepthTexture = InInputs.Depth;
 
         if (params.pDepthTexture)
         {
@@ -218,9 +221,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     if (!AutoExposure())
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &params.pExposureScaleTexture) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &params.pExposureScaleTexture);
+        params.pExposureScaleTexture = InInputs.Exposure;
 
         if (params.pExposureScaleTexture)
         {
@@ -242,8 +243,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     else
         LOG_DEBUG("AutoExposure enabled!");
 
-    ID3D12Resource* paramReactiveMask = nullptr;
-    InParameters->Get("FSR.reactive", &paramReactiveMask);
+    ID3D12Resource* paramReactiveMask = InInputs.Reactive;
     bool supportsFloatResponsivePixelMask = Version() >= feature_version { 2, 0, 1 };
 
     if (paramReactiveMask != nullptr)
@@ -264,9 +264,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     }
     else
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask);
+        paramReactiveMask = InInputs.BiasMask;
 
         if (!Config::Instance()->DisableReactiveMask.value_or(true) && paramReactiveMask)
         {
@@ -316,13 +314,9 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     _hasExposure = params.pExposureScaleTexture != nullptr;
     _accessToReactiveMask = paramReactiveMask != nullptr;
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
-
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+    if (InInputs.HasMVScale)
     {
-        xessResult = XeSSProxy::SetVelocityScale()(_xessContext, MVScaleX, MVScaleY);
+        xessResult = XeSSProxy::SetVelocityScale()(_xessContext, InInputs.MVScaleX, InInputs.MVScaleY);
 
         if (xessResult != XESS_RESULT_SUCCESS)
         {
@@ -333,20 +327,14 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     else
         LOG_WARN("Can't get motion vector scales!");
 
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X, &params.inputColorBase.x);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y, &params.inputColorBase.y);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X, &params.inputDepthBase.x);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_Y, &params.inputDepthBase.y);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_X, &params.inputMotionVectorBase.x);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_Y, &params.inputMotionVectorBase.y);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_X, &params.outputColorBase.x);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_Y, &params.outputColorBase.y);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_X,
-                      &params.inputResponsiveMaskBase.x);
-    InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_Y,
-                      &params.inputResponsiveMaskBase.y);
+    params.inputColorBase = { InInputs.ColorBase.X, InInputs.ColorBase.Y };
+    params.inputDepthBase = { InInputs.DepthBase.X, InInputs.DepthBase.Y };
+    params.inputMotionVectorBase = { InInputs.MVBase.X, InInputs.MVBase.Y };
+    params.outputColorBase = { InInputs.OutputBase.X, InInputs.OutputBase.Y };
+    params.inputResponsiveMaskBase = { InInputs.BiasMaskBase.X, InInputs.BiasMaskBase.Y };
 
     LOG_DEBUG("Executing!!");
+    barriers.Flush();
     xessResult = XeSSProxy::D3D12Execute()(_xessContext, InCommandList, &params);
 
     if (xessResult != XESS_RESULT_SUCCESS)
@@ -372,8 +360,8 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         rcasConstants.Sharpness = _sharpness;
         rcasConstants.DisplayWidth = TargetWidth();
         rcasConstants.DisplayHeight = TargetHeight();
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+        rcasConstants.MvScaleX = InInputs.MVScaleX;
+        rcasConstants.MvScaleY = InInputs.MVScaleY;
         rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
         rcasConstants.RenderHeight = RenderHeight();
         rcasConstants.RenderWidth = RenderWidth();
@@ -411,6 +399,8 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         }
     }
 
+    barriers.Flush();
+
     // imgui
     if (!Config::Instance()->OverlayMenu.value_or_default() && _frameCount > 30)
     {
@@ -7,6 +7,8 @@ class XeSSFeatureDx12 : public XeSSFeature, public IFeature_Dx12
 {
   private:
   protected:
+    bool EvaluateInputs(ID3D12GraphicsCommandList* InCommandList, const UpscaleFrameInputs& InInputs);
+
   public:
     std::string Name() const override { return "XeSS"; }
     feature_version Version() override { return XeSSFeature::Version(); }
@@ -24,6 +26,7 @@ class XeSSFeatureDx12 : public XeSSFeature, public IFeature_Dx12
     bool Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCommandList,
               NVSDK_NGX_Parameter* InParameters) override;
     bool Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_NGX_Parameter* InParameters) override;
+    bool UsesFrameInputs() const override { return true; }
 
     bool IsWithDx12() final { return false; }
 
@@ -168,6 +168,7 @@ void FinishVersionCheck()
     std::scoped_lock lock(state.versionCheckMutex);
     state.versionCheckInProgress = false;
     state.versionCheckCompleted = true;
+    state.versionCheckGeneration.fetch_add(1, std::memory_order_release);
 }
 
 void RunVersionCheck()
@@ -264,6 +265,7 @@ void VersionCheck::Start()
                 std::scoped_lock lock(state.versionCheckMutex);
                 state.versionCheckError = "Update check failed.";
                 state.updateAvailable = false;
+                state.versionCheckGeneration.fetch_add(1, std::memory_order_release);
             }
             catch (...)
             {
@@ -272,6 +274,7 @@ void VersionCheck::Start()
                 std::scoped_lock lock(state.versionCheckMutex);
                 state.versionCheckError = "Update check failed.";
                 state.updateAvailable = false;
+                state.versionCheckGeneration.fetch_add(1, std::memory_order_release);
             }
         })
         .detach();
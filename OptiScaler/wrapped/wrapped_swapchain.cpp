@@ -11,6 +11,8 @@
 #include <menu/menu_overlay_dx.h>
 
 #include <misc/FrameLimit.h>
+#include <upscalers/RenderScaleGovernor.h>
+#include <upscalers/FeatureProvider_Dx12.h>
 #include <upscaler_time/UpscalerTime_Dx11.h>
 #include <upscaler_time/UpscalerTime_Dx12.h>
 
@@ -30,7 +32,8 @@ static bool _dx11Device = false;
 static bool _dx12Device = false;
 
 static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags,
-                            const DXGI_PRESENT_PARAMETERS* pPresentParameters, IUnknown* pDevice, HWND hWnd, bool isUWP)
+                            const DXGI_PRESENT_PARAMETERS* pPresentParameters, IUnknown* pDevice,
+                            const SwapchainPresentInfo& info, HWND hWnd, bool isUWP)
 {
     if (State::Instance().isShuttingDown)
     {
@@ -59,58 +62,41 @@ static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
         State::Instance().presentFrameTime = ftDelta;
 
         if (State::Instance().currentFG == nullptr)
+        {
             State::Instance().lastFGFrameTime = ftDelta;
+            RenderScaleGovernor::FrameTime(ftDelta);
+        }
+
+        // Games which stop evaluating, like in menus, still release the kept features in time
+        if (_dx12Device)
+            FeatureProvider_Dx12::CollectPooled();
 
         LOG_DEBUG("SyncInterval: {}, Flags: {:X}, Frametime: {:0.3f} ms", SyncInterval, Flags, ftDelta);
 
-        // Update swapchain info evey frame
-        if (pSwapChain->GetDesc(&State::Instance().currentSwapchainDesc) != S_OK)
-            LOG_WARN("Can't get swapchain desc!");
+        // Only copied, desc is refreshed when the swapchain changes
+        if (info.hasDesc)
+            State::Instance().currentSwapchainDesc = info.desc;
     }
 
-    ID3D11Device* device = nullptr;
-    ID3D12Device* device12 = nullptr;
-    ID3D12CommandQueue* cq = nullptr;
+    ID3D11Device* device = info.d3d11Device;
+    ID3D12CommandQueue* cq = info.commandQueue;
 
-    // try to obtain directx objects and find the path
-    if (pDevice->QueryInterface(IID_PPV_ARGS(&device)) == S_OK)
+    if (device != nullptr)
     {
-        device->Release();
-
-        if (!_dx11Device)
-            LOG_DEBUG("D3D11Device captured");
-
-        _dx11Device = true;
         State::Instance().swapchainApi = DX11;
         State::Instance().currentD3D11Device = device;
     }
-    else if (pDevice->QueryInterface(IID_PPV_ARGS(&cq)) == S_OK)
+    else if (cq != nullptr)
     {
-        cq->Release();
-
-        if (!_dx12Device)
-            LOG_DEBUG("D3D12CommandQueue captured");
-
-        ID3D12CommandQueue* realQueue = nullptr;
-        if (Util::CheckForRealObject(__FUNCTION__, cq, (IUnknown**) &realQueue))
-            cq = realQueue;
-
         State::Instance().swapchainApi = DX12;
 
         if (State::Instance().currentCommandQueue == nullptr)
             State::Instance().currentCommandQueue = cq;
 
-        if (cq->GetDevice(IID_PPV_ARGS(&device12)) == S_OK)
+        if (info.d3d12Device != nullptr)
         {
-            device12->Release();
-
-            if (!_dx12Device)
-                LOG_DEBUG("D3D12Device captured");
-
-            _dx12Device = true;
-
-            State::Instance().currentD3D12Device = device12;
-            D3D12Hooks::HookDevice(device12);
+            State::Instance().currentD3D12Device = info.d3d12Device;
+            D3D12Hooks::HookDevice(info.d3d12Device);
         }
     }
 
@@ -262,9 +248,66 @@ WrappedIDXGISwapChain4::WrappedIDXGISwapChain4(IDXGISwapChain* real, IUnknown* p
 
     _device2 = _device;
 
+    ClassifyDevice();
+    RefreshDesc();
+
     LOG_INFO("{} created, real: {:X}, refCount: {}", _id, (UINT64) real, refCount);
 }
 
+void WrappedIDXGISwapChain4::ClassifyDevice()
+{
+    if (_device == nullptr)
+        return;
+
+    ID3D11Device* device = nullptr;
+    ID3D12CommandQueue* cq = nullptr;
+
+    // References are not kept, the swapchain holds the device/queue already
+    if (_device->QueryInterface(IID_PPV_ARGS(&device)) == S_OK)
+    {
+        device->Release();
+
+        if (!_dx11Device)
+            LOG_DEBUG("D3D11Device captured");
+
+        _dx11Device = true;
+        _presentInfo.d3d11Device = device;
+    }
+    else if (_device->QueryInterface(IID_PPV_ARGS(&cq)) == S_OK)
+    {
+        cq->Release();
+
+        if (!_dx12Device)
+            LOG_DEBUG("D3D12CommandQueue captured");
+
+        ID3D12CommandQueue* realQueue = nullptr;
+        if (Util::CheckForRealObject(__FUNCTION__, cq, (IUnknown**) &realQueue))
+            cq = realQueue;
+
+        _presentInfo.commandQueue = cq;
+
+        ID3D12Device* device12 = nullptr;
+        if (cq->GetDevice(IID_PPV_ARGS(&device12)) == S_OK)
+        {
+            device12->Release();
+
+            if (!_dx12Device)
+                LOG_DEBUG("D3D12Device captured");
+
+            _dx12Device = true;
+            _presentInfo.d3d12Device = device12;
+        }
+    }
+}
+
+void WrappedIDXGISwapChain4::RefreshDesc()
+{
+    _presentInfo.hasDesc = _real->GetDesc(&_presentInfo.desc) == S_OK;
+
+    if (!_presentInfo.hasDesc)
+        LOG_WARN("Can't get swapchain desc!");
+}
+
 WrappedIDXGISwapChain4::~WrappedIDXGISwapChain4() {}
 
 //
@@ -445,7 +488,7 @@ HRESULT STDMETHODCALLTYPE WrappedIDXGISwapChain4::Present(UINT SyncInterval, UIN
 
     if ((Flags & DXGI_PRESENT_TEST) == 0)
     {
-        result = LocalPresent(_real, SyncInterval, Flags, nullptr, _device, _handle, _uwp);
+        result = LocalPresent(_real, SyncInterval, Flags, nullptr, _device, _presentInfo, _handle, _uwp);
 
         // When Reflex can't be used to limit, sleep in present
         if (!State::Instance().reflexLimitsFps && State::Instance().activeFgOutput == FGOutput::NoFG &&
@@ -507,6 +550,8 @@ HRESULT STDMETHODCALLTYPE WrappedIDXGISwapChain4::SetFullscreenState(BOOL Fullsc
             LOG_ERROR("result: {:X}", (UINT) result);
         else
             LOG_DEBUG("result: {:X}", result);
+
+        RefreshDesc();
     }
 
     if (ffxLock)
@@ -644,6 +689,8 @@ HRESULT STDMETHODCALLTYPE WrappedIDXGISwapChain4::ResizeBuffers(UINT BufferCount
         } while (false);
     }
 
+    RefreshDesc();
+
     State::Instance().SCbuffers.clear();
     UINT bc = BufferCount;
     if (bc == 0 && _real1 != nullptr)
@@ -728,7 +775,8 @@ HRESULT STDMETHODCALLTYPE WrappedIDXGISwapChain4::Present1(UINT SyncInterval, UI
 
     if ((Flags & DXGI_PRESENT_TEST) == 0)
     {
-        result = LocalPresent(_real1, SyncInterval, Flags, pPresentParameters, _device, _handle, _uwp);
+        result = LocalPresent(_real1, SyncInterval, Flags, pPresentParameters, _device, _presentInfo, _handle,
+                              _uwp);
 
         // When Reflex can't be used to limit, sleep in present
         if (!State::Instance().reflexLimitsFps && State::Instance().activeFgOutput == FGOutput::NoFG &&
@@ -953,6 +1001,8 @@ HRESULT STDMETHODCALLTYPE WrappedIDXGISwapChain4::ResizeBuffers1(UINT BufferCoun
         } while (false);
     }
 
+    RefreshDesc();
+
     State::Instance().SCbuffers.clear();
     UINT bc = BufferCount;
     if (bc == 0 && _real1 != nullptr)
@@ -9,6 +9,18 @@
 
 #define USE_LOCAL_MUTEX
 
+// What the swapchain was created with, classified once instead of on every present
+struct SwapchainPresentInfo
+{
+    ID3D11Device* d3d11Device = nullptr;
+    ID3D12CommandQueue* commandQueue = nullptr; // Real queue, not a wrapped one
+    ID3D12Device* d3d12Device = nullptr;
+
+    // Refreshed only by ResizeBuffers, ResizeBuffers1 and SetFullscreenState
+    DXGI_SWAP_CHAIN_DESC desc {};
+    bool hasDesc = false;
+};
+
 class DECLSPEC_UUID("3af622a3-82d0-49cd-994f-cce05122c222") WrappedIDXGISwapChain4 final : public IDXGISwapChain4
 {
   public:
@@ -94,6 +106,11 @@ class DECLSPEC_UUID("3af622a3-82d0-49cd-994f-cce05122c222") WrappedIDXGISwapChai
 
     HWND _handle = nullptr;
 
+    SwapchainPresentInfo _presentInfo {};
+
+    void ClassifyDevice();
+    void RefreshDesc();
+
 #ifdef USE_LOCAL_MUTEX
     OwnedMutex _localMutex;
 #endif